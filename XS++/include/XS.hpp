@@ -34,8 +34,24 @@
 #include <XS/Info.hpp>
 #include <XS/IO/BinaryStream.hpp>
 #include <XS/IO/BinaryFileStream.hpp>
+#include <XS/IO/BinaryInflateStream.hpp>
 #include <XS/IO/BinaryDataStream.hpp>
+#include <XS/IO/BinaryMappedFileStream.hpp>
 #include <XS/IO/BinaryMemoryStream.hpp>
+#include <XS/IO/BinaryPipeStream.hpp>
+#include <XS/IO/BinarySliceStream.hpp>
+#include <XS/IO/BinaryOutputStream.hpp>
+#include <XS/IO/BinaryFileOutputStream.hpp>
+#include <XS/IO/BinaryDataOutputStream.hpp>
+#include <XS/IO/BinaryMemoryOutputStream.hpp>
+#include <XS/IO/BinaryReader.hpp>
+#include <XS/IO/BinaryRecord.hpp>
+#include <XS/IO/BitPacking.hpp>
+#include <XS/IO/BitStream.hpp>
+#include <XS/IO/ByteSwap.hpp>
+#include <XS/IO/FixedPoint.hpp>
+#include <XS/IO/ParallelParse.hpp>
+#include <XS/IO/Varint.hpp>
 #include <XS/String.hpp>
 #include <XS/ToString.hpp>
 #include <XS/UI/Color.hpp>
@@ -45,8 +45,17 @@ namespace XS
         {
             public:
                 
+                enum class Storage
+                {
+                    Contiguous,
+                    Chunked,
+                    Streaming
+                };
+                
                 BinaryDataStream();
+                explicit BinaryDataStream( Storage storage );
                 BinaryDataStream( const std::vector< uint8_t > & data );
+                BinaryDataStream( std::vector< uint8_t > && data );
                 BinaryDataStream( const BinaryDataStream & o );
                 BinaryDataStream( BinaryDataStream && o ) noexcept;
                 
@@ -62,17 +71,41 @@ namespace XS
                 void   read( uint8_t * buf, size_t size )        override;
                 void   seek( ssize_t offset, SeekDirection dir ) override;
                 size_t tell()                              const override;
+                size_t size()                              const override;
+                
+                bool supports( Capability capability ) const override;
+                
+                void readAt( size_t offset, uint8_t * buf, size_t size ) const override;
+                
+                Storage storage() const;
+                
+                size_t maximumSize() const;
+                void   setMaximumSize( size_t size );
                 
                 BinaryDataStream & operator +=( const BinaryDataStream & stream );
                 BinaryDataStream & operator +=( const std::vector< uint8_t > & data );
+                BinaryDataStream & operator +=( std::vector< uint8_t > && data );
                 
                 void append( const BinaryDataStream & stream );
                 void append( const std::vector< uint8_t > & data );
+                void append( std::vector< uint8_t > && data );
+                
+                void                   reserve( size_t capacity );
+                std::vector< uint8_t > release();
+                std::vector< uint8_t > take();
                 
                 friend void swap( BinaryDataStream & o1, BinaryDataStream & o2 );
                 
+            protected:
+                
+                bool underflow() override;
+                
             private:
                 
+                void updateBuffer( size_t pos );
+                void appendBytes( const uint8_t * data, size_t size );
+                void compact( size_t size );
+                
                 class IMPL;
                 
                 std::unique_ptr< IMPL > impl;
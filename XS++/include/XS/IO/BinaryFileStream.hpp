@@ -46,6 +46,7 @@ namespace XS
             public:
                 
                 BinaryFileStream( const std::string & path );
+                BinaryFileStream( const std::string & path, size_t blockSize );
                 
                 virtual ~BinaryFileStream() override;
                 
@@ -62,6 +63,20 @@ namespace XS
                 void   read( uint8_t * buf, size_t size )        override;
                 void   seek( ssize_t offset, SeekDirection dir ) override;
                 size_t tell()                              const override;
+                size_t size()                              const override;
+                
+                bool supports( Capability capability ) const override;
+                
+                void readAt( size_t offset, uint8_t * buf, size_t size ) const override;
+                
+                void setBufferSize( size_t size ) override;
+                
+                size_t readAheadDepth() const;
+                void   setReadAheadDepth( size_t depth );
+                
+            protected:
+                
+                bool underflow() override;
                 
             private:
                 
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BinaryInflateStream.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_BINARY_INFLATE_STREAM_HPP
+#define XS_IO_BINARY_INFLATE_STREAM_HPP
+
+#include <XS/IO/BinaryStream.hpp>
+#include <cstdint>
+#include <memory>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BinaryInflateStream: public BinaryStream
+        {
+            public:
+                
+                enum class Format
+                {
+                    Auto,
+                    Zlib,
+                    Deflate,
+                    GZip
+                };
+                
+                BinaryInflateStream( BinaryStream & stream, Format format = Format::Auto );
+                
+                virtual ~BinaryInflateStream() override;
+                
+                BinaryInflateStream( const BinaryInflateStream & o )              = delete;
+                BinaryInflateStream( BinaryInflateStream && o )                   = delete;
+                BinaryInflateStream & operator =( const BinaryInflateStream & o ) = delete;
+                BinaryInflateStream & operator =( BinaryInflateStream && o )      = delete;
+                
+                using BinaryStream::read;
+                
+                Endianness preferredEndianness()                const override;
+                void       setPreferredEndianness( Endianness value ) override;
+                
+                void   read( uint8_t * buf, size_t size )        override;
+                void   seek( ssize_t offset, SeekDirection dir ) override;
+                size_t tell()                              const override;
+                size_t size()                              const override;
+                
+                bool supports( Capability capability ) const override;
+                
+                bool finished() const;
+                
+            protected:
+                
+                bool underflow() override;
+                
+            private:
+                
+                size_t inflate( uint8_t * buf, size_t size );
+                
+                class IMPL;
+                
+                std::unique_ptr< IMPL > impl;
+        };
+    }
+}
+
+#endif /* XS_IO_BINARY_INFLATE_STREAM_HPP */
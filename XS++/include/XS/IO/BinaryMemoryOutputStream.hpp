@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BinaryMemoryOutputStream.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_BINARY_MEMORY_OUTPUT_STREAM_HPP
+#define XS_IO_BINARY_MEMORY_OUTPUT_STREAM_HPP
+
+#include <XS/IO/BinaryOutputStream.hpp>
+#include <cstdint>
+#include <memory>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BinaryMemoryOutputStream: public BinaryOutputStream
+        {
+            public:
+                
+                BinaryMemoryOutputStream( uint8_t * data, size_t size );
+                BinaryMemoryOutputStream( const BinaryMemoryOutputStream & o );
+                BinaryMemoryOutputStream( BinaryMemoryOutputStream && o ) noexcept;
+                
+                virtual ~BinaryMemoryOutputStream() override;
+                
+                BinaryMemoryOutputStream & operator =( BinaryMemoryOutputStream o );
+                
+                using BinaryOutputStream::write;
+                using BinaryOutputStream::seek;
+                
+                Endianness preferredEndianness()                const override;
+                void       setPreferredEndianness( Endianness value ) override;
+                
+                void   write( const uint8_t * buf, size_t size ) override;
+                void   seek( ssize_t offset, SeekDirection dir ) override;
+                size_t tell()                              const override;
+                
+                size_t size() const;
+                
+                friend void swap( BinaryMemoryOutputStream & o1, BinaryMemoryOutputStream & o2 );
+                
+            private:
+                
+                class IMPL;
+                
+                std::unique_ptr< IMPL > impl;
+        };
+    }
+}
+
+#endif /* XS_IO_BINARY_MEMORY_OUTPUT_STREAM_HPP */
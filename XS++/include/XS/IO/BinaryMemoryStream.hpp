@@ -36,6 +36,7 @@
 #include <cstdint>
 #include <memory>
 #include <algorithm>
+#include <span>
 
 namespace XS
 {
@@ -46,6 +47,8 @@ namespace XS
             public:
                 
                 BinaryMemoryStream( const uint8_t * data );
+                BinaryMemoryStream( const uint8_t * data, size_t size );
+                BinaryMemoryStream( std::span< const uint8_t > data );
                 BinaryMemoryStream( const BinaryMemoryStream & o );
                 BinaryMemoryStream( BinaryMemoryStream && o ) noexcept;
                 
@@ -61,6 +64,11 @@ namespace XS
                 void   read( uint8_t * buf, size_t size )        override;
                 void   seek( ssize_t offset, SeekDirection dir ) override;
                 size_t tell()                              const override;
+                size_t size()                              const override;
+                
+                bool supports( Capability capability ) const override;
+                
+                void readAt( size_t offset, uint8_t * buf, size_t size ) const override;
                 
                 friend void swap( BinaryMemoryStream & o1, BinaryMemoryStream & o2 );
                 
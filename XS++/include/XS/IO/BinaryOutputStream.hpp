@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BinaryOutputStream.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_BINARY_OUTPUT_STREAM_HPP
+#define XS_IO_BINARY_OUTPUT_STREAM_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <type_traits>
+#include <bit>
+#include <XS/Casts.hpp>
+#include <XS/IO/BinaryStream.hpp>
+#include <XS/IO/ByteSwap.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BinaryOutputStream
+        {
+            public:
+                
+                using SeekDirection = BinaryStream::SeekDirection;
+                using Endianness    = BinaryStream::Endianness;
+                
+                virtual ~BinaryOutputStream() = default;
+                
+                virtual Endianness preferredEndianness()                const = 0;
+                virtual void       setPreferredEndianness( Endianness value ) = 0;
+                
+                virtual void   write( const uint8_t * buf, size_t size ) = 0;
+                virtual size_t tell()                              const = 0;
+                virtual void   seek( ssize_t offset, SeekDirection dir ) = 0;
+                virtual void   flush();
+                
+                size_t       bufferSize() const;
+                virtual void setBufferSize( size_t size );
+                
+                void seek( ssize_t offset );
+                
+                void write( const std::vector< uint8_t > & data );
+                
+                template< typename _T_, typename std::enable_if< std::is_arithmetic< _T_ >::value && !std::is_same< _T_, bool >::value >::type * = nullptr >
+                void write( _T_ value )
+                {
+                    if constexpr( sizeof( _T_ ) > 1 )
+                    {
+                        Endianness endianness( this->preferredEndianness() );
+                        
+                        if( endianness == Endianness::LittleEndian )
+                        {
+                            this->writeLittleEndian( value );
+                            
+                            return;
+                        }
+                        else if( endianness == Endianness::BigEndian )
+                        {
+                            this->writeBigEndian( value );
+                            
+                            return;
+                        }
+                    }
+                    
+                    this->writeBuffered( reinterpret_cast< const uint8_t * >( &value ), sizeof( _T_ ) );
+                }
+                
+                template< typename _T_, typename std::enable_if< std::is_arithmetic< _T_ >::value && !std::is_same< _T_, bool >::value >::type * = nullptr >
+                void writeBigEndian( _T_ value )
+                {
+                    if constexpr( std::endian::native != std::endian::big )
+                    {
+                        value = ByteSwap::Swap( value );
+                    }
+                    
+                    this->writeBuffered( reinterpret_cast< const uint8_t * >( &value ), sizeof( _T_ ) );
+                }
+                
+                template< typename _T_, typename std::enable_if< std::is_arithmetic< _T_ >::value && !std::is_same< _T_, bool >::value >::type * = nullptr >
+                void writeLittleEndian( _T_ value )
+                {
+                    if constexpr( std::endian::native != std::endian::little )
+                    {
+                        value = ByteSwap::Swap( value );
+                    }
+                    
+                    this->writeBuffered( reinterpret_cast< const uint8_t * >( &value ), sizeof( _T_ ) );
+                }
+                
+                void writeUInt8( uint8_t value );
+                void writeInt8(  int8_t  value );
+                
+                void writeUInt16(             uint16_t value );
+                void writeBigEndianUInt16(    uint16_t value );
+                void writeLittleEndianUInt16( uint16_t value );
+                
+                void writeUInt32(             uint32_t value );
+                void writeBigEndianUInt32(    uint32_t value );
+                void writeLittleEndianUInt32( uint32_t value );
+                
+                void writeUInt64(             uint64_t value );
+                void writeBigEndianUInt64(    uint64_t value );
+                void writeLittleEndianUInt64( uint64_t value );
+                
+                void writeUInt16(             const uint16_t * values, size_t count );
+                void writeBigEndianUInt16(    const uint16_t * values, size_t count );
+                void writeLittleEndianUInt16( const uint16_t * values, size_t count );
+                
+                void writeUInt32(             const uint32_t * values, size_t count );
+                void writeBigEndianUInt32(    const uint32_t * values, size_t count );
+                void writeLittleEndianUInt32( const uint32_t * values, size_t count );
+                
+                void writeUInt64(             const uint64_t * values, size_t count );
+                void writeBigEndianUInt64(    const uint64_t * values, size_t count );
+                void writeLittleEndianUInt64( const uint64_t * values, size_t count );
+                
+                void writeFloat(             const float * values, size_t count );
+                void writeBigEndianFloat(    const float * values, size_t count );
+                void writeLittleEndianFloat( const float * values, size_t count );
+                
+                void writeDouble(             const double * values, size_t count );
+                void writeBigEndianDouble(    const double * values, size_t count );
+                void writeLittleEndianDouble( const double * values, size_t count );
+                
+                void writePascalString( const std::string & value );
+                void writeString( const std::string & value, size_t length );
+                void writeNULLTerminatedString( const std::string & value );
+                void writeNULLTerminatedUTF16String( const std::u16string & value );
+                
+            protected:
+                
+                virtual bool overflow();
+                
+                uint8_t * _bufferBegin   = nullptr;
+                uint8_t * _bufferCurrent = nullptr;
+                uint8_t * _bufferEnd     = nullptr;
+                
+            private:
+                
+                void writeBuffered( const uint8_t * buf, size_t size )
+                {
+                    if( size <= static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) )
+                    {
+                        memcpy( this->_bufferCurrent, buf, size );
+                        
+                        this->_bufferCurrent += size;
+                    }
+                    else
+                    {
+                        this->write( buf, size );
+                    }
+                }
+                
+                size_t _bufferSize = 0;
+        };
+    }
+}
+
+#endif /* XS_IO_BINARY_OUTPUT_STREAM_HPP */
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BinaryReader.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_BINARY_READER_HPP
+#define XS_IO_BINARY_READER_HPP
+
+#include <XS/IO/BinaryStream.hpp>
+#include <XS/IO/ByteSwap.hpp>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace XS
+{
+    namespace IO
+    {
+        template< typename _S_, BinaryStream::Endianness _E_ = BinaryStream::Endianness::Default >
+        class BinaryReader
+        {
+            static_assert( std::is_base_of< BinaryStream, _S_ >::value, "BinaryReader requires a BinaryStream" );
+            
+            public:
+                
+                explicit BinaryReader( _S_ & stream ):
+                    _stream( stream )
+                {}
+                
+                _S_ & stream() const
+                {
+                    return this->_stream;
+                }
+                
+                void read( uint8_t * buf, size_t size )
+                {
+                    BinaryStream & stream( this->_stream );
+                    
+                    if( size <= static_cast< size_t >( stream._bufferEnd - stream._bufferCurrent ) )
+                    {
+                        memcpy( buf, stream._bufferCurrent, size );
+                        
+                        stream._bufferCurrent += size;
+                    }
+                    else if constexpr( std::is_abstract< _S_ >::value )
+                    {
+                        this->_stream.read( buf, size );
+                    }
+                    else
+                    {
+                        this->_stream._S_::read( buf, size );
+                    }
+                }
+                
+                template< typename _T_, typename std::enable_if< std::is_arithmetic< _T_ >::value && !std::is_same< _T_, bool >::value >::type * = nullptr >
+                _T_ read()
+                {
+                    _T_ value;
+                    
+                    this->read( reinterpret_cast< uint8_t * >( &value ), sizeof( _T_ ) );
+                    
+                    if constexpr( sizeof( _T_ ) > 1 )
+                    {
+                        if( this->needsByteSwap() )
+                        {
+                            value = ByteSwap::Swap( value );
+                        }
+                    }
+                    
+                    return value;
+                }
+                
+                template< typename _T_, typename std::enable_if< std::is_arithmetic< _T_ >::value && !std::is_same< _T_, bool >::value >::type * = nullptr >
+                void read( _T_ * values, size_t count )
+                {
+                    if( count > std::numeric_limits< size_t >::max() / sizeof( _T_ ) )
+                    {
+                        throw std::runtime_error( "Invalid read - Too many values" );
+                    }
+                    
+                    this->read( reinterpret_cast< uint8_t * >( values ), count * sizeof( _T_ ) );
+                    
+                    if constexpr( sizeof( _T_ ) > 1 )
+                    {
+                        if( this->needsByteSwap() == false )
+                        {
+                            return;
+                        }
+                        
+                        if constexpr( sizeof( _T_ ) == 2 )
+                        {
+                            ByteSwap::SwapBytes16( reinterpret_cast< uint8_t * >( values ), count );
+                        }
+                        else if constexpr( sizeof( _T_ ) == 4 )
+                        {
+                            ByteSwap::SwapBytes32( reinterpret_cast< uint8_t * >( values ), count );
+                        }
+                        else if constexpr( sizeof( _T_ ) == 8 )
+                        {
+                            ByteSwap::SwapBytes64( reinterpret_cast< uint8_t * >( values ), count );
+                        }
+                    }
+                }
+                
+                uint8_t  readUInt8()  { return this->read< uint8_t  >(); }
+                int8_t   readInt8()   { return this->read< int8_t   >(); }
+                uint16_t readUInt16() { return this->read< uint16_t >(); }
+                int16_t  readInt16()  { return this->read< int16_t  >(); }
+                uint32_t readUInt32() { return this->read< uint32_t >(); }
+                int32_t  readInt32()  { return this->read< int32_t  >(); }
+                uint64_t readUInt64() { return this->read< uint64_t >(); }
+                int64_t  readInt64()  { return this->read< int64_t  >(); }
+                float    readFloat()  { return this->read< float    >(); }
+                double   readDouble() { return this->read< double   >(); }
+                
+            private:
+                
+                bool needsByteSwap() const
+                {
+                    BinaryStream::Endianness endianness( _E_ );
+                    
+                    if constexpr( _E_ == BinaryStream::Endianness::Default )
+                    {
+                        if constexpr( std::is_abstract< _S_ >::value )
+                        {
+                            endianness = this->_stream.preferredEndianness();
+                        }
+                        else
+                        {
+                            endianness = this->_stream._S_::preferredEndianness();
+                        }
+                    }
+                    
+                    if( endianness == BinaryStream::Endianness::BigEndian )
+                    {
+                        return std::endian::native != std::endian::big;
+                    }
+                    else if( endianness == BinaryStream::Endianness::LittleEndian )
+                    {
+                        return std::endian::native != std::endian::little;
+                    }
+                    
+                    return false;
+                }
+                
+                _S_ & _stream;
+        };
+        
+        template< typename _S_ >
+        using BigEndianReader = BinaryReader< _S_, BinaryStream::Endianness::BigEndian >;
+        
+        template< typename _S_ >
+        using LittleEndianReader = BinaryReader< _S_, BinaryStream::Endianness::LittleEndian >;
+    }
+}
+
+#endif /* XS_IO_BINARY_READER_HPP */
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BinaryRecord.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_BINARY_RECORD_HPP
+#define XS_IO_BINARY_RECORD_HPP
+
+#include <XS/IO/BinaryStream.hpp>
+#include <XS/IO/ByteSwap.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace XS
+{
+    namespace IO
+    {
+        template< auto _M_, BinaryStream::Endianness _E_ = BinaryStream::Endianness::Default >
+        class BinaryRecordField
+        {
+            private:
+                
+                template< typename _P_ >
+                struct Member;
+                
+                template< typename _C_, typename _T_ >
+                struct Member< _T_ _C_::* >
+                {
+                    using Class = _C_;
+                    using Type  = _T_;
+                };
+                
+            public:
+                
+                static_assert( std::is_member_object_pointer< decltype( _M_ ) >::value, "Record fields must be data member pointers" );
+                
+                using Class = typename Member< decltype( _M_ ) >::Class;
+                using Type  = typename Member< decltype( _M_ ) >::Type;
+                
+                static_assert( std::is_arithmetic< Type >::value || std::is_enum< Type >::value, "Record fields must be arithmetic or enumeration types" );
+                static_assert( sizeof( Type ) == 1 || sizeof( Type ) == 2 || sizeof( Type ) == 4 || sizeof( Type ) == 8, "Unsupported record field size" );
+                
+                static constexpr size_t size = sizeof( Type );
+                
+                static void decode( const uint8_t * data, Class & record, BinaryStream::Endianness endianness = BinaryStream::Endianness::Default )
+                {
+                    Type value;
+                    
+                    memcpy( &value, data, sizeof( Type ) );
+                    
+                    if constexpr( std::is_enum< Type >::value )
+                    {
+                        using U = typename std::underlying_type< Type >::type;
+                        
+                        value = static_cast< Type >( swap( static_cast< U >( value ), endianness ) );
+                    }
+                    else
+                    {
+                        value = swap( value, endianness );
+                    }
+                    
+                    record.*_M_ = value;
+                }
+                
+            private:
+                
+                template< typename _T_ >
+                static _T_ swap( _T_ value, BinaryStream::Endianness endianness )
+                {
+                    if constexpr( _E_ != BinaryStream::Endianness::Default )
+                    {
+                        endianness = _E_;
+                    }
+                    
+                    if( endianness == BinaryStream::Endianness::BigEndian && std::endian::native != std::endian::big )
+                    {
+                        return ByteSwap::Swap( value );
+                    }
+                    else if( endianness == BinaryStream::Endianness::LittleEndian && std::endian::native != std::endian::little )
+                    {
+                        return ByteSwap::Swap( value );
+                    }
+                    
+                    return value;
+                }
+        };
+        
+        template< size_t _N_ >
+        class BinaryRecordPadding
+        {
+            public:
+                
+                using Class = void;
+                
+                static constexpr size_t size = _N_;
+                
+                template< typename _T_ >
+                static void decode( const uint8_t *, _T_ &, BinaryStream::Endianness = BinaryStream::Endianness::Default )
+                {}
+        };
+        
+        template< auto _M_ >
+        using BigEndianField = BinaryRecordField< _M_, BinaryStream::Endianness::BigEndian >;
+        
+        template< auto _M_ >
+        using LittleEndianField = BinaryRecordField< _M_, BinaryStream::Endianness::LittleEndian >;
+        
+        template< typename _T_, typename ... _F_ >
+        class BinaryRecord
+        {
+            static_assert( sizeof ... ( _F_ ) > 0, "Records must have at least one field" );
+            static_assert( std::is_default_constructible< _T_ >::value, "Record types must be default constructible" );
+            static_assert( ( ... && ( std::is_same< typename _F_::Class, _T_ >::value || std::is_void< typename _F_::Class >::value ) ), "Record fields must belong to the record type" );
+            
+            public:
+                
+                static constexpr size_t size = ( _F_::size + ... );
+                
+                static _T_ decode( const uint8_t * data, BinaryStream::Endianness endianness = BinaryStream::Endianness::Default )
+                {
+                    _T_    record {};
+                    size_t offset( 0 );
+                    
+                    ( ( _F_::decode( data + offset, record, endianness ), offset += _F_::size ), ... );
+                    
+                    return record;
+                }
+                
+                static void decode( const uint8_t * data, _T_ * records, size_t count, BinaryStream::Endianness endianness = BinaryStream::Endianness::Default )
+                {
+                    for( size_t i = 0; i < count; i++ )
+                    {
+                        records[ i ] = decode( data + ( i * size ), endianness );
+                    }
+                }
+                
+                static _T_ read( BinaryStream & stream )
+                {
+                    std::array< uint8_t, size > data;
+                    
+                    stream.read( data.data(), size );
+                    
+                    return decode( data.data(), stream.preferredEndianness() );
+                }
+                
+                static void read( BinaryStream & stream, _T_ * records, size_t count )
+                {
+                    BinaryStream::Endianness endianness;
+                    
+                    if( count == 0 )
+                    {
+                        return;
+                    }
+                    
+                    if( count > std::numeric_limits< size_t >::max() / size )
+                    {
+                        throw std::runtime_error( "Invalid read - Too many records" );
+                    }
+                    
+                    endianness = stream.preferredEndianness();
+                    
+                    if( stream.supports( BinaryStream::Capability::Views ) )
+                    {
+                        std::span< const uint8_t > view( stream.readView( count * size ) );
+                        
+                        decode( view.data(), records, count, endianness );
+                    }
+                    else
+                    {
+                        size_t                 batch( std::min( count, std::max< size_t >( 1, 65536 / size ) ) );
+                        std::vector< uint8_t > data( batch * size );
+                        
+                        while( count > 0 )
+                        {
+                            batch = std::min( batch, count );
+                            
+                            stream.read( data.data(), batch * size );
+                            decode( data.data(), records, batch, endianness );
+                            
+                            records += batch;
+                            count   -= batch;
+                        }
+                    }
+                }
+                
+                static std::vector< _T_ > read( BinaryStream & stream, size_t count )
+                {
+                    std::vector< _T_ > records( count );
+                    
+                    read( stream, records.data(), count );
+                    
+                    return records;
+                }
+        };
+    }
+}
+
+#endif /* XS_IO_BINARY_RECORD_HPP */
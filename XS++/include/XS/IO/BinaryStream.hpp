@@ -31,15 +31,23 @@
 #define XS_IO_BINARY_STREAM_HPP
 
 #include <string>
+#include <string_view>
+#include <limits>
+#include <span>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <type_traits>
+#include <bit>
 #include <XS/Casts.hpp>
+#include <XS/IO/ByteSwap.hpp>
 
 namespace XS
 {
     namespace IO
     {
+        class BinarySliceStream;
+        
         class BinaryStream
         {
             public:
@@ -58,6 +66,16 @@ namespace XS
                     BigEndian
                 };
                 
+                enum class Capability
+                {
+                    Size,
+                    Seek,
+                    Views,
+                    PositionalRead,
+                    Refill,
+                    StableViews
+                };
+                
                 virtual ~BinaryStream() = default;
                 
                 virtual Endianness preferredEndianness()                const = 0;
@@ -66,10 +84,18 @@ namespace XS
                 virtual void   read( uint8_t * buf, size_t size )        = 0;
                 virtual size_t tell()                              const = 0;
                 virtual void   seek( ssize_t offset, SeekDirection dir ) = 0;
+                virtual size_t size()                              const = 0;
+                
+                virtual bool supports( Capability capability ) const = 0;
+                
+                virtual void readAt( size_t offset, uint8_t * buf, size_t size ) const;
                 
                 bool   hasBytesAvailable();
                 size_t availableBytes();
                 
+                size_t       bufferSize() const;
+                virtual void setBufferSize( size_t size );
+                
                 void seek( ssize_t offset );
                 
                 template< typename T, typename std::enable_if< std::is_integral< T >::value && std::is_unsigned< T >::value >::type * = nullptr >
@@ -87,6 +113,65 @@ namespace XS
                 std::vector< uint8_t > read( size_t size );
                 std::vector< uint8_t > readAll();
                 
+                std::span< const uint8_t > readView( size_t size );
+                std::string_view           readStringView( size_t length );
+                
+                BinarySliceStream slice( size_t offset, size_t length ) const;
+                
+                template< typename _T_, typename std::enable_if< std::is_arithmetic< _T_ >::value && !std::is_same< _T_, bool >::value >::type * = nullptr >
+                _T_ read()
+                {
+                    _T_ value;
+                    
+                    if constexpr( sizeof( _T_ ) > 1 )
+                    {
+                        Endianness endianness( this->preferredEndianness() );
+                        
+                        if( endianness == Endianness::LittleEndian )
+                        {
+                            return this->readLittleEndian< _T_ >();
+                        }
+                        else if( endianness == Endianness::BigEndian )
+                        {
+                            return this->readBigEndian< _T_ >();
+                        }
+                    }
+                    
+                    this->readBuffered( reinterpret_cast< uint8_t * >( &value ), sizeof( _T_ ) );
+                    
+                    return value;
+                }
+                
+                template< typename _T_, typename std::enable_if< std::is_arithmetic< _T_ >::value && !std::is_same< _T_, bool >::value >::type * = nullptr >
+                _T_ readBigEndian()
+                {
+                    _T_ value;
+                    
+                    this->readBuffered( reinterpret_cast< uint8_t * >( &value ), sizeof( _T_ ) );
+                    
+                    if constexpr( std::endian::native != std::endian::big )
+                    {
+                        value = ByteSwap::Swap( value );
+                    }
+                    
+                    return value;
+                }
+                
+                template< typename _T_, typename std::enable_if< std::is_arithmetic< _T_ >::value && !std::is_same< _T_, bool >::value >::type * = nullptr >
+                _T_ readLittleEndian()
+                {
+                    _T_ value;
+                    
+                    this->readBuffered( reinterpret_cast< uint8_t * >( &value ), sizeof( _T_ ) );
+                    
+                    if constexpr( std::endian::native != std::endian::little )
+                    {
+                        value = ByteSwap::Swap( value );
+                    }
+                    
+                    return value;
+                }
+                
                 uint8_t readUInt8();
                 int8_t  readInt8();
                 
@@ -102,13 +187,78 @@ namespace XS
                 uint64_t readBigEndianUInt64();
                 uint64_t readLittleEndianUInt64();
                 
+                void readUInt16(             uint16_t * values, size_t count );
+                void readBigEndianUInt16(    uint16_t * values, size_t count );
+                void readLittleEndianUInt16( uint16_t * values, size_t count );
+                
+                void readUInt32(             uint32_t * values, size_t count );
+                void readBigEndianUInt32(    uint32_t * values, size_t count );
+                void readLittleEndianUInt32( uint32_t * values, size_t count );
+                
+                void readUInt64(             uint64_t * values, size_t count );
+                void readBigEndianUInt64(    uint64_t * values, size_t count );
+                void readLittleEndianUInt64( uint64_t * values, size_t count );
+                
+                void readFloat(             float * values, size_t count );
+                void readBigEndianFloat(    float * values, size_t count );
+                void readLittleEndianFloat( float * values, size_t count );
+                
+                void readDouble(             double * values, size_t count );
+                void readBigEndianDouble(    double * values, size_t count );
+                void readLittleEndianDouble( double * values, size_t count );
+                
                 float readBigEndianFixedPoint( unsigned int integerLength, unsigned int fractionalLength );
                 float readLittleEndianFixedPoint( unsigned int integerLength, unsigned int fractionalLength );
                 
+                uint64_t readULEB128();
+                int64_t  readSLEB128();
+                uint64_t readVarint();
+                
+                void readULEB128( uint32_t * values, size_t count );
+                void readULEB128( uint64_t * values, size_t count );
+                
+                void readBitPacked( uint32_t * values, size_t count, unsigned int width );
+                
                 std::string    readPascalString();
                 std::string    readString( size_t length );
-                std::string    readNULLTerminatedString();
-                std::u16string readNULLTerminatedUTF16String();
+                std::string    readNULLTerminatedString(      size_t maxLength = std::numeric_limits< size_t >::max() );
+                std::u16string readNULLTerminatedUTF16String( size_t maxLength = std::numeric_limits< size_t >::max() );
+                
+            protected:
+                
+                template< typename _S_, Endianness _E_ >
+                friend class BinaryReader;
+                
+                friend class BitStream;
+                friend class BinarySliceStream;
+                friend class BinaryInflateStream;
+                
+                virtual bool underflow();
+                
+                const uint8_t * _bufferBegin   = nullptr;
+                const uint8_t * _bufferCurrent = nullptr;
+                const uint8_t * _bufferEnd     = nullptr;
+                
+            private:
+                
+                void readBuffered( uint8_t * buf, size_t size )
+                {
+                    if( size <= static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) )
+                    {
+                        memcpy( buf, this->_bufferCurrent, size );
+                        
+                        this->_bufferCurrent += size;
+                    }
+                    else
+                    {
+                        this->read( buf, size );
+                    }
+                }
+                
+                template< typename _T_ >
+                void readULEB128Array( _T_ * values, size_t count );
+                
+                size_t _bufferSize = 0;
         };
     }
 }
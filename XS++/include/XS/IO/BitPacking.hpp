@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BitPacking.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_BIT_PACKING_HPP
+#define XS_IO_BIT_PACKING_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace BitPacking
+        {
+            size_t PackedSize( size_t count, unsigned int width );
+            
+            size_t Unpack( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width );
+            size_t UnpackFrameOfReference( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width, uint32_t reference );
+            size_t UnpackDelta( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width, uint32_t previous = 0 );
+        }
+    }
+}
+
+#endif /* XS_IO_BIT_PACKING_HPP */
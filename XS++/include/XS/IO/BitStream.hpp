@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BitStream.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_BIT_STREAM_HPP
+#define XS_IO_BIT_STREAM_HPP
+
+#include <XS/IO/BinaryStream.hpp>
+#include <cstdint>
+#include <stdexcept>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BitStream
+        {
+            public:
+                
+                enum class BitOrder
+                {
+                    MSBFirst,
+                    LSBFirst
+                };
+                
+                explicit BitStream( BinaryStream & stream, BitOrder order = BitOrder::MSBFirst );
+                
+                BitStream( const BitStream & o )              = delete;
+                BitStream( BitStream && o )                   = delete;
+                BitStream & operator =( const BitStream & o ) = delete;
+                BitStream & operator =( BitStream && o )      = delete;
+                
+                BinaryStream & stream() const;
+                BitOrder       order()  const;
+                
+                uint64_t readBits( unsigned int count )
+                {
+                    uint64_t value;
+                    
+                    if( count > 56 )
+                    {
+                        return this->readLongBits( count );
+                    }
+                    
+                    if( this->_count < count )
+                    {
+                        this->refill( count );
+                    }
+                    
+                    value = this->buffered( count );
+                    
+                    this->consume( count );
+                    
+                    return value;
+                }
+                
+                uint64_t peekBits( unsigned int count )
+                {
+                    if( count > 56 )
+                    {
+                        throw std::runtime_error( "Invalid bit count" );
+                    }
+                    
+                    if( this->_count < count )
+                    {
+                        this->refill( count );
+                    }
+                    
+                    return this->buffered( count );
+                }
+                
+                bool readBit()
+                {
+                    return this->readBits( 1 ) != 0;
+                }
+                
+                void     skipBits( size_t count );
+                void     alignToByte();
+                uint64_t readExpGolomb();
+                int64_t  readSignedExpGolomb();
+                void     release();
+                
+            private:
+                
+                uint64_t buffered( unsigned int count ) const
+                {
+                    if( this->_order == BitOrder::LSBFirst )
+                    {
+                        return this->_bits & ( ( uint64_t( 1 ) << count ) - 1 );
+                    }
+                    
+                    return ( count == 0 ) ? 0 : this->_bits >> ( 64 - count );
+                }
+                
+                void consume( unsigned int count )
+                {
+                    if( this->_order == BitOrder::LSBFirst )
+                    {
+                        this->_bits >>= count;
+                    }
+                    else
+                    {
+                        this->_bits <<= count;
+                    }
+                    
+                    this->_count -= count;
+                }
+                
+                void     refill( unsigned int count );
+                uint64_t readLongBits( unsigned int count );
+                
+                BinaryStream & _stream;
+                BitOrder       _order;
+                uint64_t       _bits;
+                unsigned int   _count;
+        };
+    }
+}
+
+#endif /* XS_IO_BIT_STREAM_HPP */
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ByteSwap.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_BYTE_SWAP_HPP
+#define XS_IO_BYTE_SWAP_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace ByteSwap
+        {
+            void Swap16( uint16_t * values, size_t count );
+            void Swap32( uint32_t * values, size_t count );
+            void Swap64( uint64_t * values, size_t count );
+            
+            void SwapBytes16( uint8_t * data, size_t count );
+            void SwapBytes32( uint8_t * data, size_t count );
+            void SwapBytes64( uint8_t * data, size_t count );
+            
+            template
+            <
+                typename _T_,
+                typename std::enable_if
+                <
+                       std::is_arithmetic< _T_ >::value
+                    && ( sizeof( _T_ ) == 1 || sizeof( _T_ ) == 2 || sizeof( _T_ ) == 4 || sizeof( _T_ ) == 8 )
+                >
+                ::type * = nullptr
+            >
+            _T_ Swap( _T_ value )
+            {
+                if constexpr( sizeof( _T_ ) == 2 )
+                {
+                    uint16_t n;
+                    
+                    memcpy( &n, &value, sizeof( n ) );
+                    
+                    n = __builtin_bswap16( n );
+                    
+                    memcpy( &value, &n, sizeof( n ) );
+                }
+                else if constexpr( sizeof( _T_ ) == 4 )
+                {
+                    uint32_t n;
+                    
+                    memcpy( &n, &value, sizeof( n ) );
+                    
+                    n = __builtin_bswap32( n );
+                    
+                    memcpy( &value, &n, sizeof( n ) );
+                }
+                else if constexpr( sizeof( _T_ ) == 8 )
+                {
+                    uint64_t n;
+                    
+                    memcpy( &n, &value, sizeof( n ) );
+                    
+                    n = __builtin_bswap64( n );
+                    
+                    memcpy( &value, &n, sizeof( n ) );
+                }
+                
+                return value;
+            }
+        }
+    }
+}
+
+#endif /* XS_IO_BYTE_SWAP_HPP */
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      FixedPoint.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_FIXED_POINT_HPP
+#define XS_IO_FIXED_POINT_HPP
+
+#include <XS/IO/BinaryStream.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace XS
+{
+    namespace IO
+    {
+        void FixedPointToFloat( const int8_t   * values, float * out, size_t count, float scale );
+        void FixedPointToFloat( const uint8_t  * values, float * out, size_t count, float scale );
+        void FixedPointToFloat( const int16_t  * values, float * out, size_t count, float scale );
+        void FixedPointToFloat( const uint16_t * values, float * out, size_t count, float scale );
+        void FixedPointToFloat( const int32_t  * values, float * out, size_t count, float scale );
+        void FixedPointToFloat( const uint32_t * values, float * out, size_t count, float scale );
+        
+        template< unsigned int _I_, unsigned int _F_, bool _S_ = true >
+        class FixedPoint
+        {
+            static_assert( _I_ + _F_ == 8 || _I_ + _F_ == 16 || _I_ + _F_ == 32, "Fixed point values must be 8, 16 or 32 bits wide" );
+            
+            private:
+                
+                using Signed   = typename std::conditional< _I_ + _F_ == 8, int8_t,  typename std::conditional< _I_ + _F_ == 16, int16_t,  int32_t  >::type >::type;
+                using Unsigned = typename std::conditional< _I_ + _F_ == 8, uint8_t, typename std::conditional< _I_ + _F_ == 16, uint16_t, uint32_t >::type >::type;
+                
+            public:
+                
+                using Storage = typename std::conditional< _S_, Signed, Unsigned >::type;
+                
+                static constexpr unsigned int integerLength    = _I_;
+                static constexpr unsigned int fractionalLength = _F_;
+                static constexpr bool         isSigned         = _S_;
+                static constexpr float        scale            = 1.0f / static_cast< float >( uint64_t( 1 ) << _F_ );
+                static constexpr double       scaleDouble      = 1.0  / static_cast< double >( uint64_t( 1 ) << _F_ );
+                
+                static constexpr float toFloat( Storage value )
+                {
+                    return static_cast< float >( value ) * scale;
+                }
+                
+                static constexpr double toDouble( Storage value )
+                {
+                    return static_cast< double >( value ) * scaleDouble;
+                }
+                
+                static void toFloat( const Storage * values, float * out, size_t count )
+                {
+                    FixedPointToFloat( values, out, count, scale );
+                }
+                
+                static float read( BinaryStream & stream )
+                {
+                    return toFloat( stream.read< Storage >() );
+                }
+                
+                static float readBigEndian( BinaryStream & stream )
+                {
+                    return toFloat( stream.readBigEndian< Storage >() );
+                }
+                
+                static float readLittleEndian( BinaryStream & stream )
+                {
+                    return toFloat( stream.readLittleEndian< Storage >() );
+                }
+                
+                static void read( BinaryStream & stream, float * out, size_t count )
+                {
+                    readArray( stream, out, count, stream.preferredEndianness() );
+                }
+                
+                static void readBigEndian( BinaryStream & stream, float * out, size_t count )
+                {
+                    readArray( stream, out, count, BinaryStream::Endianness::BigEndian );
+                }
+                
+                static void readLittleEndian( BinaryStream & stream, float * out, size_t count )
+                {
+                    readArray( stream, out, count, BinaryStream::Endianness::LittleEndian );
+                }
+                
+            private:
+                
+                static void readArray( BinaryStream & stream, float * out, size_t count, BinaryStream::Endianness endianness )
+                {
+                    std::array< Unsigned, 1024 > values;
+                    
+                    while( count > 0 )
+                    {
+                        size_t n( std::min( count, values.size() ) );
+                        
+                        if constexpr( sizeof( Storage ) == 1 )
+                        {
+                            stream.read( values.data(), n );
+                        }
+                        else if constexpr( sizeof( Storage ) == 2 )
+                        {
+                            if( endianness == BinaryStream::Endianness::BigEndian )
+                            {
+                                stream.readBigEndianUInt16( values.data(), n );
+                            }
+                            else if( endianness == BinaryStream::Endianness::LittleEndian )
+                            {
+                                stream.readLittleEndianUInt16( values.data(), n );
+                            }
+                            else
+                            {
+                                stream.readUInt16( values.data(), n );
+                            }
+                        }
+                        else
+                        {
+                            if( endianness == BinaryStream::Endianness::BigEndian )
+                            {
+                                stream.readBigEndianUInt32( values.data(), n );
+                            }
+                            else if( endianness == BinaryStream::Endianness::LittleEndian )
+                            {
+                                stream.readLittleEndianUInt32( values.data(), n );
+                            }
+                            else
+                            {
+                                stream.readUInt32( values.data(), n );
+                            }
+                        }
+                        
+                        FixedPointToFloat( reinterpret_cast< const Storage * >( values.data() ), out, n, scale );
+                        
+                        out   += n;
+                        count -= n;
+                    }
+                }
+        };
+        
+        using Fixed8_8    = FixedPoint<  8,  8, true  >;
+        using Fixed16_16  = FixedPoint< 16, 16, true  >;
+        using Fixed2_30   = FixedPoint<  2, 30, true  >;
+        using UFixed8_8   = FixedPoint<  8,  8, false >;
+        using UFixed16_16 = FixedPoint< 16, 16, false >;
+        using UFixed2_30  = FixedPoint<  2, 30, false >;
+    }
+}
+
+#endif /* XS_IO_FIXED_POINT_HPP */
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ParallelParse.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_PARALLEL_PARSE_HPP
+#define XS_IO_PARALLEL_PARSE_HPP
+
+#include <XS/IO/BinaryStream.hpp>
+#include <XS/IO/BinarySliceStream.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace ParallelParse
+        {
+            using Range  = std::pair< size_t, size_t >;
+            using Finder = std::function< size_t( const BinaryStream & stream, size_t offset ) >;
+            
+            std::vector< Range > FixedSizeRanges( size_t size, size_t recordSize, size_t recordsPerRange );
+            std::vector< Range > IndexRanges( const std::vector< size_t > & offsets, size_t size );
+            std::vector< Range > BoundaryRanges( const BinaryStream & stream, size_t count, const Finder & finder );
+            
+            void ForEach( size_t count, size_t threads, const std::function< void( size_t index ) > & body );
+            
+            template< typename _F_, typename _T_ = std::decay_t< std::invoke_result_t< _F_ &, BinarySliceStream & > > >
+            auto Run( const BinaryStream & stream, const std::vector< Range > & ranges, _F_ parse, size_t threads = 0 )
+            {
+                if constexpr( std::is_void< _T_ >::value )
+                {
+                    ForEach( ranges.size(), threads, [ & ]( size_t index )
+                    {
+                        BinarySliceStream slice( stream.slice( ranges[ index ].first, ranges[ index ].second ) );
+                        
+                        std::invoke( parse, slice );
+                    } );
+                }
+                else
+                {
+                    std::vector< std::optional< _T_ > > results( ranges.size() );
+                    std::vector< _T_ >                  merged;
+                    
+                    ForEach( ranges.size(), threads, [ & ]( size_t index )
+                    {
+                        BinarySliceStream slice( stream.slice( ranges[ index ].first, ranges[ index ].second ) );
+                        
+                        results[ index ].emplace( std::invoke( parse, slice ) );
+                    } );
+                    
+                    merged.reserve( results.size() );
+                    
+                    for( std::optional< _T_ > & result: results )
+                    {
+                        merged.push_back( std::move( *result ) );
+                    }
+                    
+                    return merged;
+                }
+            }
+        }
+    }
+}
+
+#endif /* XS_IO_PARALLEL_PARSE_HPP */
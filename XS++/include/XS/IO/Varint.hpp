@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      Varint.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_VARINT_HPP
+#define XS_IO_VARINT_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace Varint
+        {
+            size_t Decode( const uint8_t * data, size_t size, uint32_t & value );
+            size_t Decode( const uint8_t * data, size_t size, uint64_t & value );
+            size_t DecodeSigned( const uint8_t * data, size_t size, int64_t & value );
+            
+            size_t Decode( const uint8_t * data, size_t size, uint32_t * values, size_t count );
+            size_t Decode( const uint8_t * data, size_t size, uint64_t * values, size_t count );
+            size_t DecodeZigZag( const uint8_t * data, size_t size, int32_t * values, size_t count );
+            size_t DecodeZigZag( const uint8_t * data, size_t size, int64_t * values, size_t count );
+            size_t DecodeDelta( const uint8_t * data, size_t size, uint32_t * values, size_t count, uint32_t previous = 0 );
+            size_t DecodeDelta( const uint8_t * data, size_t size, uint64_t * values, size_t count, uint64_t previous = 0 );
+            
+            size_t StreamVByteDecode( const uint8_t * data, size_t size, uint32_t * values, size_t count );
+            size_t StreamVByteDecodeZigZag( const uint8_t * data, size_t size, int32_t * values, size_t count );
+            size_t StreamVByteDecodeDelta( const uint8_t * data, size_t size, uint32_t * values, size_t count, uint32_t previous = 0 );
+        }
+    }
+}
+
+#endif /* XS_IO_VARINT_HPP */
@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryDataOutputStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <XS/IO/BinaryDataOutputStream.hpp>
+#include <XS/Casts.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BinaryDataOutputStream::IMPL
+        {
+            public:
+                
+                IMPL();
+                IMPL( const IMPL & o );
+                ~IMPL();
+                
+                std::vector< uint8_t > _data;
+                size_t                 _size;
+                Endianness             _endianness;
+        };
+        
+        BinaryDataOutputStream::BinaryDataOutputStream():
+            impl( std::make_unique< IMPL >() )
+        {}
+        
+        BinaryDataOutputStream::BinaryDataOutputStream( const BinaryDataOutputStream & o ):
+            impl( std::make_unique< IMPL >( *( o.impl ) ) )
+        {
+            this->impl->_size = o.size();
+            
+            this->impl->_data.resize( this->impl->_size );
+            this->updateBuffer( o.tell() );
+        }
+        
+        BinaryDataOutputStream::BinaryDataOutputStream( BinaryDataOutputStream && o ) noexcept:
+            BinaryOutputStream( o ),
+            impl( std::move( o.impl ) )
+        {
+            o._bufferBegin   = nullptr;
+            o._bufferCurrent = nullptr;
+            o._bufferEnd     = nullptr;
+        }
+        
+        BinaryDataOutputStream::~BinaryDataOutputStream()
+        {}
+        
+        BinaryDataOutputStream & BinaryDataOutputStream::operator =( BinaryDataOutputStream o )
+        {
+            swap( *( this ), o );
+            
+            return *( this );
+        }
+        
+        BinaryOutputStream::Endianness BinaryDataOutputStream::preferredEndianness() const
+        {
+            return this->impl->_endianness;
+        }
+        
+        void BinaryDataOutputStream::setPreferredEndianness( Endianness value )
+        {
+            this->impl->_endianness = value;
+        }
+        
+        void BinaryDataOutputStream::write( const uint8_t * buf, size_t size )
+        {
+            if( size == 0 )
+            {
+                return;
+            }
+            
+            if( size > static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) )
+            {
+                size_t pos( this->tell() );
+                
+                this->impl->_size = this->size();
+                
+                this->impl->_data.resize( std::max( pos + size, std::max( this->impl->_data.size() * 2, static_cast< size_t >( 256 ) ) ) );
+                this->updateBuffer( pos );
+            }
+            
+            memcpy( this->_bufferCurrent, buf, size );
+            
+            this->_bufferCurrent += size;
+        }
+        
+        void BinaryDataOutputStream::seek( ssize_t offset, SeekDirection dir )
+        {
+            size_t pos;
+            size_t cur( this->tell() );
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
+            size_t size( this->size() );
+            
+            if( dir == SeekDirection::Begin )
+            {
+                if( offset < 0 )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = numeric_cast< size_t >( offset );
+            }
+            else if( dir == SeekDirection::End )
+            {
+                if( offset > 0 || distance > size )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = size - distance;
+            }
+            else if( offset < 0 )
+            {
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
+            }
+            else
+            {
+                pos = cur + numeric_cast< size_t >( offset );
+            }
+            
+            if( pos > size )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            this->impl->_size    = size;
+            this->_bufferCurrent = this->_bufferBegin + pos;
+        }
+        
+        size_t BinaryDataOutputStream::tell() const
+        {
+            return static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin );
+        }
+        
+        size_t BinaryDataOutputStream::size() const
+        {
+            return std::max( this->impl->_size, this->tell() );
+        }
+        
+        const std::vector< uint8_t > & BinaryDataOutputStream::data()
+        {
+            size_t pos( this->tell() );
+            
+            this->impl->_size = this->size();
+            
+            this->impl->_data.resize( this->impl->_size );
+            this->updateBuffer( pos );
+            
+            return this->impl->_data;
+        }
+        
+        std::vector< uint8_t > BinaryDataOutputStream::release()
+        {
+            std::vector< uint8_t > data( std::move( this->impl->_data ) );
+            
+            data.resize( this->size() );
+            
+            this->impl->_data.clear();
+            
+            this->impl->_size = 0;
+            
+            this->updateBuffer( 0 );
+            
+            return data;
+        }
+        
+        void BinaryDataOutputStream::updateBuffer( size_t pos )
+        {
+            this->_bufferBegin   = this->impl->_data.data();
+            this->_bufferCurrent = this->_bufferBegin + pos;
+            this->_bufferEnd     = this->_bufferBegin + this->impl->_data.size();
+        }
+        
+        void swap( BinaryDataOutputStream & o1, BinaryDataOutputStream & o2 )
+        {
+            using std::swap;
+            
+            swap( o1.impl,           o2.impl );
+            swap( o1._bufferBegin,   o2._bufferBegin );
+            swap( o1._bufferCurrent, o2._bufferCurrent );
+            swap( o1._bufferEnd,     o2._bufferEnd );
+        }
+        
+        BinaryDataOutputStream::IMPL::IMPL():
+            _size(       0 ),
+            _endianness( Endianness::Default )
+        {}
+        
+        BinaryDataOutputStream::IMPL::IMPL( const IMPL & o ):
+            _data(       o._data ),
+            _size(       o._size ),
+            _endianness( o._endianness )
+        {}
+        
+        BinaryDataOutputStream::IMPL::~IMPL()
+        {}
+    }
+}
@@ -29,7 +29,10 @@
 
 #include <fstream>
 #include <cmath>
+#include <cstring>
 #include <vector>
+#include <algorithm>
+#include <limits>
 #include <XS/IO/BinaryDataStream.hpp>
 #include <XS/Casts.hpp>
 
@@ -42,30 +45,60 @@ namespace XS
             public:
                 
                 IMPL();
+                IMPL( Storage storage );
                 IMPL( const std::vector< uint8_t > & data );
+                IMPL( std::vector< uint8_t > && data );
                 IMPL( const IMPL & o );
                 ~IMPL();
                 
-                std::vector< uint8_t > _data;
-                size_t                 _pos;
-                Endianness             _endianness;
+                void addChunk( std::vector< uint8_t > && chunk );
+                
+                Storage                               _storage;
+                std::vector< uint8_t >                _data;
+                std::vector< std::vector< uint8_t > > _chunks;
+                std::vector< size_t >                 _offsets;
+                size_t                                _size;
+                size_t                                _chunk;
+                size_t                                _base;
+                size_t                                _discarded;
+                size_t                                _maximumSize;
+                Endianness                            _endianness;
         };
         
         BinaryDataStream::BinaryDataStream():
             impl( std::make_unique< IMPL >() )
         {}
         
+        BinaryDataStream::BinaryDataStream( Storage storage ):
+            impl( std::make_unique< IMPL >( storage ) )
+        {}
+        
         BinaryDataStream::BinaryDataStream( const std::vector< uint8_t > & data ):
             impl( std::make_unique< IMPL >( data ) )
-        {}
+        {
+            this->updateBuffer( 0 );
+        }
+        
+        BinaryDataStream::BinaryDataStream( std::vector< uint8_t > && data ):
+            impl( std::make_unique< IMPL >( std::move( data ) ) )
+        {
+            this->updateBuffer( 0 );
+        }
         
         BinaryDataStream::BinaryDataStream( const BinaryDataStream & o ):
             impl( std::make_unique< IMPL >( *( o.impl ) ) )
-        {}
+        {
+            this->updateBuffer( o.tell() );
+        }
         
         BinaryDataStream::BinaryDataStream( BinaryDataStream && o ) noexcept:
+            BinaryStream( o ),
             impl( std::move( o.impl ) )
-        {}
+        {
+            o._bufferBegin   = nullptr;
+            o._bufferCurrent = nullptr;
+            o._bufferEnd     = nullptr;
+        }
         
         BinaryDataStream::~BinaryDataStream()
         {}
@@ -94,19 +127,35 @@ namespace XS
                 return;
             }
             
-            if( size > this->impl->_data.size() - this->impl->_pos )
+            if( size > this->size() - this->tell() )
             {
                 throw std::runtime_error( "Invalid read - Not enough data available" );
             }
             
-            memcpy( buf, &( this->impl->_data[ 0 ] ) + this->impl->_pos, size );
-            
-            this->impl->_pos += size;
+            while( 1 )
+            {
+                size_t length( std::min( size, static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) ) );
+                
+                memcpy( buf, this->_bufferCurrent, length );
+                
+                this->_bufferCurrent += length;
+                buf                  += length;
+                size                 -= length;
+                
+                if( size == 0 )
+                {
+                    break;
+                }
+                
+                this->underflow();
+            }
         }
         
         void BinaryDataStream::seek( ssize_t offset, SeekDirection dir )
         {
             size_t pos;
+            size_t cur( this->tell() );
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
             
             if( dir == SeekDirection::Begin )
             {
@@ -119,33 +168,120 @@ namespace XS
             }
             else if( dir == SeekDirection::End )
             {
-                if( offset > 0 )
+                if( offset > 0 || distance > this->size() )
                 {
                     throw std::runtime_error( "Invalid seek offset" );
                 }
                 
-                pos = this->impl->_data.size() - numeric_cast< size_t >( abs( offset ) );
+                pos = this->size() - distance;
             }
             else if( offset < 0 )
             {
-                pos = this->impl->_pos - numeric_cast< size_t >( abs( offset ) );
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
             }
             else
             {
-                pos = this->impl->_pos + numeric_cast< size_t >( offset );
+                pos = cur + numeric_cast< size_t >( offset );
             }
             
-            if( pos > this->impl->_data.size() )
+            if( pos > this->size() || pos < this->impl->_discarded )
             {
                 throw std::runtime_error( "Invalid seek offset" );
             }
             
-            this->impl->_pos = pos;
+            this->updateBuffer( pos );
         }
         
         size_t BinaryDataStream::tell() const
         {
-            return this->impl->_pos;
+            return this->impl->_base + static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin );
+        }
+        
+        size_t BinaryDataStream::size() const
+        {
+            if( this->impl->_storage == Storage::Chunked )
+            {
+                return this->impl->_size;
+            }
+            
+            return this->impl->_discarded + this->impl->_data.size();
+        }
+        
+        bool BinaryDataStream::supports( Capability capability ) const
+        {
+            switch( capability )
+            {
+                case Capability::Size:           return true;
+                case Capability::Seek:           return true;
+                case Capability::Views:          return this->impl->_storage != Storage::Chunked;
+                case Capability::PositionalRead: return true;
+                case Capability::Refill:         return false;
+                case Capability::StableViews:    return false;
+            }
+            
+            return false;
+        }
+        
+        void BinaryDataStream::readAt( size_t offset, uint8_t * buf, size_t size ) const
+        {
+            size_t chunk;
+            
+            if( offset > this->size() || size > this->size() - offset )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            if( size == 0 )
+            {
+                return;
+            }
+            
+            if( this->impl->_storage != Storage::Chunked )
+            {
+                if( offset < this->impl->_discarded )
+                {
+                    throw std::runtime_error( "Invalid read - Data has been discarded" );
+                }
+                
+                memcpy( buf, this->impl->_data.data() + ( offset - this->impl->_discarded ), size );
+                
+                return;
+            }
+            
+            chunk = static_cast< size_t >( std::upper_bound( this->impl->_offsets.begin(), this->impl->_offsets.end(), offset ) - this->impl->_offsets.begin() ) - 1;
+            
+            while( size > 0 )
+            {
+                size_t start( offset - this->impl->_offsets[ chunk ] );
+                size_t length( std::min( size, this->impl->_chunks[ chunk ].size() - start ) );
+                
+                memcpy( buf, this->impl->_chunks[ chunk ].data() + start, length );
+                
+                buf    += length;
+                offset += length;
+                size   -= length;
+                chunk  += 1;
+            }
+        }
+        
+        BinaryDataStream::Storage BinaryDataStream::storage() const
+        {
+            return this->impl->_storage;
+        }
+        
+        size_t BinaryDataStream::maximumSize() const
+        {
+            return this->impl->_maximumSize;
+        }
+        
+        void BinaryDataStream::setMaximumSize( size_t size )
+        {
+            this->impl->_maximumSize = size;
         }
         
         BinaryDataStream & BinaryDataStream::operator +=( const BinaryDataStream & stream )
@@ -162,53 +298,292 @@ namespace XS
             return *( this );
         }
         
+        BinaryDataStream & BinaryDataStream::operator +=( std::vector< uint8_t > && data )
+        {
+            this->append( std::move( data ) );
+            
+            return *( this );
+        }
+        
         void BinaryDataStream::append( const BinaryDataStream & stream )
         {
-            this->impl->_data.insert
-            (
-                this->impl->_data.end(),
-                stream.impl->_data.begin() + numeric_cast< ssize_t >( stream.impl->_pos ),
-                stream.impl->_data.end()
-            );
+            BinaryDataStream & source( const_cast< BinaryDataStream & >( stream ) );
             
-            stream.impl->_pos = stream.impl->_data.size();
+            do
+            {
+                this->appendBytes( source._bufferCurrent, static_cast< size_t >( source._bufferEnd - source._bufferCurrent ) );
+                
+                source._bufferCurrent = source._bufferEnd;
+            }
+            while( source.underflow() );
         }
         
         void BinaryDataStream::append( const std::vector< uint8_t > & data )
         {
-            this->impl->_data.insert
-            (
-                this->impl->_data.end(),
-                data.begin(),
-                data.end()
-            );
+            this->appendBytes( data.data(), data.size() );
+        }
+        
+        void BinaryDataStream::append( std::vector< uint8_t > && data )
+        {
+            size_t pos( this->tell() );
+            
+            this->compact( data.size() );
+            
+            if( this->impl->_storage == Storage::Chunked )
+            {
+                this->impl->addChunk( std::move( data ) );
+            }
+            else if( this->impl->_data.empty() && data.size() > this->impl->_data.capacity() )
+            {
+                this->impl->_data = std::move( data );
+            }
+            else
+            {
+                this->impl->_data.insert
+                (
+                    this->impl->_data.end(),
+                    data.begin(),
+                    data.end()
+                );
+            }
+            
+            this->updateBuffer( pos );
+        }
+        
+        void BinaryDataStream::reserve( size_t capacity )
+        {
+            size_t pos( this->tell() );
+            
+            if( this->impl->_storage == Storage::Chunked )
+            {
+                return;
+            }
+            
+            this->impl->_data.reserve( capacity );
+            this->updateBuffer( pos );
+        }
+        
+        std::vector< uint8_t > BinaryDataStream::release()
+        {
+            std::vector< uint8_t > data( std::move( this->impl->_data ) );
+            
+            if( this->impl->_storage == Storage::Chunked )
+            {
+                data.clear();
+                data.reserve( this->impl->_size );
+                
+                for( const auto & chunk: this->impl->_chunks )
+                {
+                    data.insert( data.end(), chunk.begin(), chunk.end() );
+                }
+                
+                this->impl->_chunks.clear();
+                this->impl->_offsets.clear();
+                
+                this->impl->_size = 0;
+            }
+            
+            this->impl->_discarded = 0;
+            
+            this->impl->_data.clear();
+            this->updateBuffer( 0 );
+            
+            return data;
+        }
+        
+        std::vector< uint8_t > BinaryDataStream::take()
+        {
+            size_t                 pos( this->tell() - this->impl->_discarded );
+            std::vector< uint8_t > data( this->release() );
+            
+            data.erase( data.begin(), data.begin() + numeric_cast< std::ptrdiff_t >( pos ) );
+            
+            return data;
+        }
+        
+        bool BinaryDataStream::underflow()
+        {
+            if( this->_bufferCurrent != this->_bufferEnd )
+            {
+                return true;
+            }
+            
+            if( this->impl->_storage != Storage::Chunked || this->impl->_chunk + 1 >= this->impl->_chunks.size() )
+            {
+                return false;
+            }
+            
+            this->impl->_chunk++;
+            
+            this->impl->_base    = this->impl->_offsets[ this->impl->_chunk ];
+            this->_bufferBegin   = this->impl->_chunks[ this->impl->_chunk ].data();
+            this->_bufferCurrent = this->_bufferBegin;
+            this->_bufferEnd     = this->_bufferBegin + this->impl->_chunks[ this->impl->_chunk ].size();
+            
+            return true;
+        }
+        
+        void BinaryDataStream::updateBuffer( size_t pos )
+        {
+            if( this->impl->_storage != Storage::Chunked )
+            {
+                this->impl->_base    = this->impl->_discarded;
+                this->_bufferBegin   = this->impl->_data.data();
+                this->_bufferCurrent = this->_bufferBegin + ( pos - this->impl->_base );
+                this->_bufferEnd     = this->_bufferBegin + this->impl->_data.size();
+                
+                return;
+            }
+            
+            if( this->impl->_chunks.empty() )
+            {
+                this->impl->_chunk   = 0;
+                this->impl->_base    = 0;
+                this->_bufferBegin   = nullptr;
+                this->_bufferCurrent = nullptr;
+                this->_bufferEnd     = nullptr;
+                
+                return;
+            }
+            
+            this->impl->_chunk = static_cast< size_t >( std::upper_bound( this->impl->_offsets.begin(), this->impl->_offsets.end(), pos ) - this->impl->_offsets.begin() ) - 1;
+            
+            this->impl->_base    = this->impl->_offsets[ this->impl->_chunk ];
+            this->_bufferBegin   = this->impl->_chunks[ this->impl->_chunk ].data();
+            this->_bufferCurrent = this->_bufferBegin + ( pos - this->impl->_base );
+            this->_bufferEnd     = this->_bufferBegin + this->impl->_chunks[ this->impl->_chunk ].size();
+        }
+        
+        void BinaryDataStream::appendBytes( const uint8_t * data, size_t size )
+        {
+            size_t pos( this->tell() );
+            
+            if( size == 0 )
+            {
+                return;
+            }
+            
+            this->compact( size );
+            
+            if( this->impl->_storage == Storage::Chunked )
+            {
+                this->impl->addChunk( std::vector< uint8_t >( data, data + size ) );
+            }
+            else
+            {
+                this->impl->_data.insert( this->impl->_data.end(), data, data + size );
+            }
+            
+            this->updateBuffer( pos );
+        }
+        
+        void BinaryDataStream::compact( size_t size )
+        {
+            size_t consumed( 0 );
+            size_t retained( this->size() );
+            
+            if( this->impl->_storage == Storage::Streaming )
+            {
+                consumed = static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin );
+                retained = this->impl->_data.size() - consumed;
+            }
+            
+            if( size > this->impl->_maximumSize || retained > this->impl->_maximumSize - size )
+            {
+                throw std::runtime_error( "Invalid append - Maximum size exceeded" );
+            }
+            
+            if( consumed == 0 )
+            {
+                return;
+            }
+            
+            if( consumed < retained && this->impl->_data.size() + size <= this->impl->_data.capacity() )
+            {
+                return;
+            }
+            
+            this->impl->_data.erase( this->impl->_data.begin(), this->impl->_data.begin() + numeric_cast< std::ptrdiff_t >( consumed ) );
+            
+            this->impl->_discarded += consumed;
+            
+            this->updateBuffer( this->impl->_discarded );
         }
         
         void swap( BinaryDataStream & o1, BinaryDataStream & o2 )
         {
             using std::swap;
             
-            swap( o1.impl, o2.impl );
+            swap( o1.impl,           o2.impl );
+            swap( o1._bufferBegin,   o2._bufferBegin );
+            swap( o1._bufferCurrent, o2._bufferCurrent );
+            swap( o1._bufferEnd,     o2._bufferEnd );
         }
         
         BinaryDataStream::IMPL::IMPL():
-            _pos(        0 ),
-            _endianness( Endianness::Default )
+            IMPL( Storage::Contiguous )
+        {}
+        
+        BinaryDataStream::IMPL::IMPL( Storage storage ):
+            _storage(     storage ),
+            _size(        0 ),
+            _chunk(       0 ),
+            _base(        0 ),
+            _discarded(   0 ),
+            _maximumSize( std::numeric_limits< size_t >::max() ),
+            _endianness(  Endianness::Default )
         {}
         
         BinaryDataStream::IMPL::IMPL( const std::vector< uint8_t > & data ):
-            _data(       data ),
-            _pos(        0 ),
-            _endianness( Endianness::Default )
+            _storage(     Storage::Contiguous ),
+            _data(        data ),
+            _size(        0 ),
+            _chunk(       0 ),
+            _base(        0 ),
+            _discarded(   0 ),
+            _maximumSize( std::numeric_limits< size_t >::max() ),
+            _endianness(  Endianness::Default )
+        {}
+        
+        BinaryDataStream::IMPL::IMPL( std::vector< uint8_t > && data ):
+            _storage(     Storage::Contiguous ),
+            _data(        std::move( data ) ),
+            _size(        0 ),
+            _chunk(       0 ),
+            _base(        0 ),
+            _discarded(   0 ),
+            _maximumSize( std::numeric_limits< size_t >::max() ),
+            _endianness(  Endianness::Default )
         {}
         
         BinaryDataStream::IMPL::IMPL( const IMPL & o ):
-            _data(       o._data ),
-            _pos(        o._pos ),
-            _endianness( o._endianness )
+            _storage(     o._storage ),
+            _data(        o._data ),
+            _chunks(      o._chunks ),
+            _offsets(     o._offsets ),
+            _size(        o._size ),
+            _chunk(       o._chunk ),
+            _base(        o._base ),
+            _discarded(   o._discarded ),
+            _maximumSize( o._maximumSize ),
+            _endianness(  o._endianness )
         {}
         
         BinaryDataStream::IMPL::~IMPL()
         {}
+        
+        void BinaryDataStream::IMPL::addChunk( std::vector< uint8_t > && chunk )
+        {
+            if( chunk.empty() )
+            {
+                return;
+            }
+            
+            this->_offsets.push_back( this->_size );
+            
+            this->_size += chunk.size();
+            
+            this->_chunks.push_back( std::move( chunk ) );
+        }
     }
 }
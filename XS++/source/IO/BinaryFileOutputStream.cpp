@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryFileOutputStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <fstream>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <XS/IO/BinaryFileOutputStream.hpp>
+#include <XS/Casts.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BinaryFileOutputStream::IMPL
+        {
+            public:
+                
+                IMPL( const std::string & path );
+                ~IMPL();
+                
+                std::ofstream          _stream;
+                std::string            _path;
+                size_t                 _size;
+                size_t                 _pos;
+                Endianness             _endianness;
+                std::vector< uint8_t > _buffer;
+        };
+        
+        BinaryFileOutputStream::BinaryFileOutputStream( const std::string & path ):
+            impl( std::make_unique< IMPL >( path ) )
+        {
+            this->setBufferSize( 65536 );
+        }
+        
+        BinaryFileOutputStream::~BinaryFileOutputStream()
+        {
+            if( this->impl->_stream.is_open() && this->_bufferCurrent != this->_bufferBegin )
+            {
+                this->impl->_stream.write( reinterpret_cast< const char * >( this->_bufferBegin ), static_cast< std::streamsize >( this->_bufferCurrent - this->_bufferBegin ) );
+            }
+        }
+        
+        BinaryOutputStream::Endianness BinaryFileOutputStream::preferredEndianness() const
+        {
+            return this->impl->_endianness;
+        }
+        
+        void BinaryFileOutputStream::setPreferredEndianness( Endianness value )
+        {
+            this->impl->_endianness = value;
+        }
+        
+        void BinaryFileOutputStream::write( const uint8_t * buf, size_t size )
+        {
+            if( this->impl->_stream.is_open() == false )
+            {
+                throw std::runtime_error( "Invalid file stream" );
+            }
+            
+            if( size <= static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) )
+            {
+                memcpy( this->_bufferCurrent, buf, size );
+                
+                this->_bufferCurrent += size;
+                
+                return;
+            }
+            
+            this->overflow();
+            
+            if( size >= this->bufferSize() )
+            {
+                this->impl->_stream.write( reinterpret_cast< const char * >( buf ), numeric_cast< std::streamsize >( size ) );
+                
+                if( this->impl->_stream.fail() )
+                {
+                    throw std::runtime_error( "Invalid write - Cannot write to file" );
+                }
+                
+                this->impl->_pos += size;
+                this->impl->_size = std::max( this->impl->_size, this->impl->_pos );
+            }
+            else
+            {
+                memcpy( this->_bufferCurrent, buf, size );
+                
+                this->_bufferCurrent += size;
+            }
+        }
+        
+        void BinaryFileOutputStream::seek( ssize_t offset, SeekDirection dir )
+        {
+            size_t pos;
+            size_t cur( this->tell() );
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
+            size_t size( std::max( this->impl->_size, cur ) );
+            
+            if( dir == SeekDirection::Begin )
+            {
+                if( offset < 0 )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = numeric_cast< size_t >( offset );
+            }
+            else if( dir == SeekDirection::End )
+            {
+                if( offset > 0 || distance > size )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = size - distance;
+            }
+            else if( offset < 0 )
+            {
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
+            }
+            else
+            {
+                pos = cur + numeric_cast< size_t >( offset );
+            }
+            
+            if( pos > size )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            this->overflow();
+            
+            this->impl->_pos = pos;
+            
+            this->impl->_stream.seekp( numeric_cast< std::streamsize >( pos ), std::ios_base::beg );
+        }
+        
+        size_t BinaryFileOutputStream::tell() const
+        {
+            if( this->impl->_stream.is_open() == false )
+            {
+                throw std::runtime_error( "Invalid file stream" );
+            }
+            
+            return this->impl->_pos + static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin );
+        }
+        
+        void BinaryFileOutputStream::flush()
+        {
+            if( this->impl->_stream.is_open() == false )
+            {
+                throw std::runtime_error( "Invalid file stream" );
+            }
+            
+            this->overflow();
+            this->impl->_stream.flush();
+        }
+        
+        void BinaryFileOutputStream::setBufferSize( size_t size )
+        {
+            if( this->impl->_stream.is_open() )
+            {
+                this->overflow();
+            }
+            
+            this->_bufferBegin   = nullptr;
+            this->_bufferCurrent = nullptr;
+            this->_bufferEnd     = nullptr;
+            
+            this->impl->_buffer.clear();
+            this->impl->_buffer.shrink_to_fit();
+            
+            BinaryOutputStream::setBufferSize( size );
+        }
+        
+        bool BinaryFileOutputStream::overflow()
+        {
+            size_t length( static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin ) );
+            
+            if( length > 0 )
+            {
+                this->impl->_stream.write( reinterpret_cast< const char * >( this->_bufferBegin ), numeric_cast< std::streamsize >( length ) );
+                
+                this->_bufferCurrent = this->_bufferBegin;
+                
+                if( this->impl->_stream.fail() )
+                {
+                    throw std::runtime_error( "Invalid write - Cannot write to file" );
+                }
+                
+                this->impl->_pos += length;
+                this->impl->_size = std::max( this->impl->_size, this->impl->_pos );
+            }
+            
+            if( this->bufferSize() == 0 )
+            {
+                return false;
+            }
+            
+            this->impl->_buffer.resize( this->bufferSize() );
+            
+            this->_bufferBegin   = this->impl->_buffer.data();
+            this->_bufferCurrent = this->_bufferBegin;
+            this->_bufferEnd     = this->_bufferBegin + this->impl->_buffer.size();
+            
+            return true;
+        }
+        
+        BinaryFileOutputStream::IMPL::IMPL( const std::string & path ):
+            _path( path ),
+            _size( 0 ),
+            _pos( 0 ),
+            _endianness( Endianness::Default )
+        {
+            this->_stream.rdbuf()->pubsetbuf( nullptr, 0 );
+            this->_stream.open( this->_path, std::ios::binary | std::ios::out | std::ios::trunc );
+        }
+        
+        BinaryFileOutputStream::IMPL::~IMPL()
+        {
+            if( this->_stream.is_open() )
+            {
+                this->_stream.close();
+            }
+        }
+    }
+}
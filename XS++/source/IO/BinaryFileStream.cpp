@@ -27,9 +27,18 @@
  * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
  */
 
-#include <fstream>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <XS/IO/BinaryFileStream.hpp>
 #include <XS/Casts.hpp>
 
@@ -37,6 +46,24 @@ namespace XS
 {
     namespace IO
     {
+        namespace
+        {
+            constexpr size_t bufferAlignment( 4096 );
+            constexpr size_t defaultBlockSize( 65536 );
+            
+            uint8_t * AllocateAligned( size_t size )
+            {
+                void * data( nullptr );
+                
+                if( posix_memalign( &data, bufferAlignment, size ) != 0 )
+                {
+                    throw std::bad_alloc();
+                }
+                
+                return static_cast< uint8_t * >( data );
+            }
+        }
+        
         class BinaryFileStream::IMPL
         {
             public:
@@ -44,17 +71,61 @@ namespace XS
                 IMPL( const std::string & path );
                 ~IMPL();
                 
-                std::ifstream _stream;
-                std::string   _path;
-                size_t        _size;
-                size_t        _pos;
-                Endianness    _endianness;
+                class Block
+                {
+                    public:
+                        
+                        uint8_t * _data;
+                        size_t    _offset;
+                        size_t    _length;
+                        bool      _valid;
+                };
+                
+                void readAt( uint8_t * buf, size_t size, size_t offset ) const;
+                void allocateBuffer( size_t size );
+                void releaseBuffer();
+                
+                void startReadAhead( size_t blockSize );
+                void stopReadAhead();
+                void suspendReadAhead();
+                void resumeReadAhead( size_t offset );
+                bool nextBlock( size_t offset, Block & block );
+                void run();
+                
+                int                      _fd;
+                std::string              _path;
+                size_t                   _size;
+                size_t                   _pos;
+                Endianness               _endianness;
+                uint8_t                * _buffer;
+                size_t                   _capacity;
+                size_t                   _depth;
+                size_t                   _blockSize;
+                size_t                   _sequential;
+                size_t                   _next;
+                size_t                   _generation;
+                bool                     _active;
+                bool                     _stop;
+                bool                     _reading;
+                uint8_t                * _held;
+                std::vector< uint8_t * > _blocks;
+                std::vector< uint8_t * > _free;
+                std::deque< Block >      _ready;
+                std::mutex               _mutex;
+                std::condition_variable  _condition;
+                std::thread              _thread;
         };
         
         BinaryFileStream::BinaryFileStream( const std::string & path ):
-            impl( std::make_unique< IMPL >( path ) )
+            BinaryFileStream( path, defaultBlockSize )
         {}
         
+        BinaryFileStream::BinaryFileStream( const std::string & path, size_t blockSize ):
+            impl( std::make_unique< IMPL >( path ) )
+        {
+            BinaryStream::setBufferSize( blockSize );
+        }
+        
         BinaryFileStream::~BinaryFileStream()
         {}
         
@@ -70,24 +141,53 @@ namespace XS
         
         void BinaryFileStream::read( uint8_t * buf, size_t size )
         {
-            if( this->impl->_stream.is_open() == false )
-            {
-                throw std::runtime_error( "Invalid file stream" );
-            }
+            size_t pos( this->tell() );
             
-            if( size > this->impl->_size - this->impl->_pos )
+            if( size > this->impl->_size - pos )
             {
                 throw std::runtime_error( "Invalid read - Not enough data available" );
             }
             
-            this->impl->_pos += size;
-            
-            this->impl->_stream.read( reinterpret_cast< char * >( buf ), numeric_cast< std::streamsize >( size ) );
+            while( size > 0 )
+            {
+                size_t buffered( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+                
+                if( buffered == 0 && size >= this->bufferSize() && this->impl->_active == false )
+                {
+                    pos = this->tell();
+                    
+                    this->impl->readAt( buf, size, pos );
+                    
+                    this->_bufferBegin   = nullptr;
+                    this->_bufferCurrent = nullptr;
+                    this->_bufferEnd     = nullptr;
+                    this->impl->_pos     = pos + size;
+                    
+                    return;
+                }
+                
+                if( buffered == 0 )
+                {
+                    this->underflow();
+                    
+                    buffered = static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent );
+                }
+                
+                buffered = std::min( buffered, size );
+                
+                memcpy( buf, this->_bufferCurrent, buffered );
+                
+                this->_bufferCurrent += buffered;
+                buf                  += buffered;
+                size                 -= buffered;
+            }
         }
         
         void BinaryFileStream::seek( ssize_t offset, SeekDirection dir )
         {
             size_t pos;
+            size_t cur( this->tell() );
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
             
             if( dir == SeekDirection::Begin )
             {
@@ -100,20 +200,25 @@ namespace XS
             }
             else if( dir == SeekDirection::End )
             {
-                if( offset > 0 )
+                if( offset > 0 || distance > this->impl->_size )
                 {
                     throw std::runtime_error( "Invalid seek offset" );
                 }
                 
-                pos = this->impl->_size - numeric_cast< size_t >( abs( offset ) );
+                pos = this->impl->_size - distance;
             }
             else if( offset < 0 )
             {
-                pos = this->impl->_pos - numeric_cast< size_t >( abs( offset ) );
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
             }
             else
             {
-                pos = this->impl->_pos + numeric_cast< size_t >( offset );
+                pos = cur + numeric_cast< size_t >( offset );
             }
             
             if( pos > this->impl->_size )
@@ -121,47 +226,437 @@ namespace XS
                 throw std::runtime_error( "Invalid seek offset" );
             }
             
-            this->impl->_pos = pos;
+            {
+                size_t start( this->impl->_pos - static_cast< size_t >( this->_bufferEnd - this->_bufferBegin ) );
+                
+                if( this->_bufferBegin != nullptr && pos >= start && pos <= this->impl->_pos )
+                {
+                    this->_bufferCurrent = this->_bufferBegin + ( pos - start );
+                    
+                    return;
+                }
+            }
+            
+            this->_bufferBegin   = nullptr;
+            this->_bufferCurrent = nullptr;
+            this->_bufferEnd     = nullptr;
+            this->impl->_pos     = pos;
             
-            this->impl->_stream.seekg( numeric_cast< std::streamsize >( pos ), std::ios_base::beg );
+            if( this->impl->_depth > 0 )
+            {
+                this->impl->suspendReadAhead();
+            }
         }
         
         size_t BinaryFileStream::tell() const
         {
-            if( this->impl->_stream.is_open() == false )
+            if( this->impl->_fd == -1 )
             {
                 throw std::runtime_error( "Invalid file stream" );
             }
             
-            return this->impl->_pos;
+            return this->impl->_pos - static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent );
         }
         
-        BinaryFileStream::IMPL::IMPL( const std::string & path ):
-            _path( path ),
-            _size( 0 ),
-            _pos( 0 ),
-            _endianness( Endianness::Default )
+        size_t BinaryFileStream::size() const
+        {
+            return this->impl->_size;
+        }
+        
+        bool BinaryFileStream::supports( Capability capability ) const
+        {
+            switch( capability )
+            {
+                case Capability::Size:           return true;
+                case Capability::Seek:           return true;
+                case Capability::Views:          return false;
+                case Capability::PositionalRead: return true;
+                case Capability::Refill:         return false;
+                case Capability::StableViews:    return false;
+            }
+            
+            return false;
+        }
+        
+        void BinaryFileStream::readAt( size_t offset, uint8_t * buf, size_t size ) const
         {
-            this->_stream.open( this->_path, std::ios::binary | std::ios::in );
+            if( this->impl->_fd == -1 )
+            {
+                throw std::runtime_error( "Invalid file stream" );
+            }
+            
+            if( offset > this->impl->_size || size > this->impl->_size - offset )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
             
-            if( this->_stream.good() )
+            this->impl->readAt( buf, size, offset );
+        }
+        
+        void BinaryFileStream::setBufferSize( size_t size )
+        {
+            if( this->_bufferBegin != nullptr )
             {
-                std::streamsize pos;
+                size_t pos( this->tell() );
                 
-                this->_stream.seekg( 0, std::ios_base::end );
+                this->_bufferBegin   = nullptr;
+                this->_bufferCurrent = nullptr;
+                this->_bufferEnd     = nullptr;
+                this->impl->_pos     = pos;
+            }
+            
+            this->impl->stopReadAhead();
+            this->impl->releaseBuffer();
+            
+            BinaryStream::setBufferSize( size );
+            
+            this->impl->startReadAhead( size );
+        }
+        
+        size_t BinaryFileStream::readAheadDepth() const
+        {
+            return this->impl->_depth;
+        }
+        
+        void BinaryFileStream::setReadAheadDepth( size_t depth )
+        {
+            if( this->_bufferBegin != nullptr )
+            {
+                size_t pos( this->tell() );
                 
-                pos         = this->_stream.tellg();
-                this->_size = numeric_cast< size_t >( pos );
+                this->_bufferBegin   = nullptr;
+                this->_bufferCurrent = nullptr;
+                this->_bufferEnd     = nullptr;
+                this->impl->_pos     = pos;
+            }
+            
+            this->impl->stopReadAhead();
+            
+            this->impl->_depth = depth;
+            
+            this->impl->startReadAhead( this->bufferSize() );
+        }
+        
+        bool BinaryFileStream::underflow()
+        {
+            size_t pos;
+            size_t start;
+            size_t length;
+            
+            if( this->_bufferCurrent != this->_bufferEnd )
+            {
+                return true;
+            }
+            
+            if( this->impl->_fd == -1 || this->bufferSize() == 0 || this->impl->_pos == this->impl->_size )
+            {
+                return false;
+            }
+            
+            pos    = this->impl->_pos;
+            start  = pos - ( pos % this->bufferSize() );
+            
+            if( this->impl->_active )
+            {
+                IMPL::Block block;
                 
-                this->_stream.seekg( 0, std::ios_base::beg );
+                if( this->impl->nextBlock( start, block ) )
+                {
+                    if( block._valid == false )
+                    {
+                        throw std::runtime_error( "Invalid read - Cannot read from file" );
+                    }
+                    
+                    this->impl->_pos     = start + block._length;
+                    this->_bufferBegin   = block._data;
+                    this->_bufferCurrent = this->_bufferBegin + ( pos - start );
+                    this->_bufferEnd     = this->_bufferBegin + block._length;
+                    
+                    return true;
+                }
+            }
+            
+            length = std::min( this->bufferSize(), this->impl->_size - start );
+            
+            this->impl->allocateBuffer( this->bufferSize() );
+            this->impl->readAt( this->impl->_buffer, length, start );
+            
+            this->impl->_pos     = start + length;
+            this->_bufferBegin   = this->impl->_buffer;
+            this->_bufferCurrent = this->_bufferBegin + ( pos - start );
+            this->_bufferEnd     = this->_bufferBegin + length;
+            
+            if( this->impl->_depth > 0 && ++( this->impl->_sequential ) >= 2 )
+            {
+                this->impl->resumeReadAhead( start + length );
+            }
+            
+            return true;
+        }
+        
+        BinaryFileStream::IMPL::IMPL( const std::string & path ):
+            _fd(         -1 ),
+            _path(       path ),
+            _size(       0 ),
+            _pos(        0 ),
+            _endianness( Endianness::Default ),
+            _buffer(     nullptr ),
+            _capacity(   0 ),
+            _depth(      0 ),
+            _blockSize(  0 ),
+            _sequential( 0 ),
+            _next(       0 ),
+            _generation( 0 ),
+            _active(     false ),
+            _stop(       false ),
+            _reading(    false ),
+            _held(       nullptr )
+        {
+            struct stat st;
+            
+            this->_fd = open( this->_path.c_str(), O_RDONLY );
+            
+            if( this->_fd != -1 && fstat( this->_fd, &st ) == 0 )
+            {
+                this->_size = numeric_cast< size_t >( st.st_size );
             }
         }
         
         BinaryFileStream::IMPL::~IMPL()
         {
-            if( this->_stream.is_open() )
+            this->stopReadAhead();
+            this->releaseBuffer();
+            
+            if( this->_fd != -1 )
+            {
+                close( this->_fd );
+            }
+        }
+        
+        void BinaryFileStream::IMPL::readAt( uint8_t * buf, size_t size, size_t offset ) const
+        {
+            while( size > 0 )
+            {
+                ssize_t length( pread( this->_fd, buf, size, numeric_cast< off_t >( offset ) ) );
+                
+                if( length < 0 && errno == EINTR )
+                {
+                    continue;
+                }
+                
+                if( length <= 0 )
+                {
+                    throw std::runtime_error( "Invalid read - Cannot read from file" );
+                }
+                
+                buf    += length;
+                size   -= static_cast< size_t >( length );
+                offset += static_cast< size_t >( length );
+            }
+        }
+        
+        void BinaryFileStream::IMPL::allocateBuffer( size_t size )
+        {
+            if( this->_capacity >= size )
+            {
+                return;
+            }
+            
+            this->releaseBuffer();
+            
+            this->_buffer   = AllocateAligned( size );
+            this->_capacity = size;
+        }
+        
+        void BinaryFileStream::IMPL::releaseBuffer()
+        {
+            free( this->_buffer );
+            
+            this->_buffer   = nullptr;
+            this->_capacity = 0;
+        }
+        
+        void BinaryFileStream::IMPL::startReadAhead( size_t blockSize )
+        {
+            if( this->_depth == 0 || blockSize == 0 || this->_fd == -1 )
+            {
+                return;
+            }
+            
+            this->_blockSize  = blockSize;
+            this->_sequential = 1;
+            this->_active     = false;
+            this->_stop       = false;
+            
+            try
+            {
+                for( size_t i = 0; i <= this->_depth; i++ )
+                {
+                    this->_blocks.push_back( nullptr );
+                    
+                    this->_blocks.back() = AllocateAligned( blockSize );
+                    
+                    this->_free.push_back( this->_blocks.back() );
+                }
+            }
+            catch( ... )
+            {
+                this->stopReadAhead();
+                
+                throw;
+            }
+            
+            this->_thread = std::thread( &IMPL::run, this );
+        }
+        
+        void BinaryFileStream::IMPL::stopReadAhead()
+        {
+            {
+                std::lock_guard< std::mutex > lock( this->_mutex );
+                
+                this->_stop = true;
+            }
+            
+            this->_condition.notify_all();
+            
+            if( this->_thread.joinable() )
+            {
+                this->_thread.join();
+            }
+            
+            for( uint8_t * block: this->_blocks )
+            {
+                free( block );
+            }
+            
+            this->_blocks.clear();
+            this->_free.clear();
+            this->_ready.clear();
+            
+            this->_held   = nullptr;
+            this->_active = false;
+        }
+        
+        void BinaryFileStream::IMPL::suspendReadAhead()
+        {
+            std::lock_guard< std::mutex > lock( this->_mutex );
+            
+            for( const Block & block: this->_ready )
+            {
+                this->_free.push_back( block._data );
+            }
+            
+            if( this->_held != nullptr )
+            {
+                this->_free.push_back( this->_held );
+            }
+            
+            this->_ready.clear();
+            
+            this->_held        = nullptr;
+            this->_active      = false;
+            this->_sequential  = 0;
+            this->_generation += 1;
+        }
+        
+        void BinaryFileStream::IMPL::resumeReadAhead( size_t offset )
+        {
+            {
+                std::lock_guard< std::mutex > lock( this->_mutex );
+                
+                this->_active      = true;
+                this->_next        = offset;
+                this->_generation += 1;
+            }
+            
+            this->_condition.notify_all();
+        }
+        
+        bool BinaryFileStream::IMPL::nextBlock( size_t offset, Block & block )
+        {
+            {
+                std::unique_lock< std::mutex > lock( this->_mutex );
+                
+                if( this->_held != nullptr )
+                {
+                    this->_free.push_back( this->_held );
+                    
+                    this->_held = nullptr;
+                    
+                    this->_condition.notify_all();
+                }
+                
+                this->_condition.wait( lock, [ this ] { return this->_ready.empty() == false || ( this->_next >= this->_size && this->_reading == false ); } );
+                
+                if( this->_ready.empty() == false && this->_ready.front()._offset == offset )
+                {
+                    block       = this->_ready.front();
+                    this->_held = block._data;
+                    
+                    this->_ready.pop_front();
+                    this->_condition.notify_all();
+                    
+                    return true;
+                }
+            }
+            
+            this->suspendReadAhead();
+            
+            return false;
+        }
+        
+        void BinaryFileStream::IMPL::run()
+        {
+            std::unique_lock< std::mutex > lock( this->_mutex );
+            
+            while( 1 )
             {
-                this->_stream.close();
+                Block  block;
+                size_t generation;
+                
+                this->_condition.wait( lock, [ this ] { return this->_stop || ( this->_active && this->_free.empty() == false && this->_next < this->_size ); } );
+                
+                if( this->_stop )
+                {
+                    return;
+                }
+                
+                block._data   = this->_free.back();
+                block._offset = this->_next;
+                block._length = std::min( this->_blockSize, this->_size - this->_next );
+                block._valid  = true;
+                generation    = this->_generation;
+                
+                this->_free.pop_back();
+                
+                this->_next    += block._length;
+                this->_reading  = true;
+                
+                lock.unlock();
+                
+                try
+                {
+                    this->readAt( block._data, block._length, block._offset );
+                }
+                catch( const std::runtime_error & )
+                {
+                    block._valid = false;
+                }
+                
+                lock.lock();
+                
+                this->_reading = false;
+                
+                if( generation == this->_generation )
+                {
+                    this->_ready.push_back( block );
+                }
+                else
+                {
+                    this->_free.push_back( block._data );
+                }
+                
+                this->_condition.notify_all();
             }
         }
     }
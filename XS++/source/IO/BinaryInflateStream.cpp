@@ -0,0 +1,395 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryInflateStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <cstring>
+#include <vector>
+#include <zlib.h>
+#include <XS/IO/BinaryInflateStream.hpp>
+#include <XS/Casts.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace
+        {
+            constexpr size_t defaultBufferSize( 65536 );
+        }
+        
+        class BinaryInflateStream::IMPL
+        {
+            public:
+                
+                IMPL( BinaryStream & stream, Format format );
+                ~IMPL();
+                
+                bool fill();
+                bool nextMember();
+                
+                BinaryStream         & _stream;
+                Format                 _format;
+                z_stream               _zstream;
+                bool                   _finished;
+                size_t                 _pos;
+                Endianness             _endianness;
+                std::vector< uint8_t > _input;
+                std::vector< uint8_t > _output;
+        };
+        
+        BinaryInflateStream::BinaryInflateStream( BinaryStream & stream, Format format ):
+            impl( std::make_unique< IMPL >( stream, format ) )
+        {}
+        
+        BinaryInflateStream::~BinaryInflateStream()
+        {}
+        
+        BinaryStream::Endianness BinaryInflateStream::preferredEndianness() const
+        {
+            return this->impl->_endianness;
+        }
+        
+        void BinaryInflateStream::setPreferredEndianness( Endianness value )
+        {
+            this->impl->_endianness = value;
+        }
+        
+        void BinaryInflateStream::read( uint8_t * buf, size_t size )
+        {
+            while( size > 0 )
+            {
+                size_t buffered( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+                
+                if( buffered == 0 && size >= std::max( this->bufferSize(), defaultBufferSize ) )
+                {
+                    buffered = this->inflate( buf, size );
+                    
+                    if( buffered == 0 )
+                    {
+                        throw std::runtime_error( "Invalid read - Not enough data available" );
+                    }
+                    
+                    this->_bufferBegin   = nullptr;
+                    this->_bufferCurrent = nullptr;
+                    this->_bufferEnd     = nullptr;
+                    this->impl->_pos    += buffered;
+                    buf                 += buffered;
+                    size                -= buffered;
+                    
+                    continue;
+                }
+                
+                if( buffered == 0 )
+                {
+                    if( this->underflow() == false )
+                    {
+                        throw std::runtime_error( "Invalid read - Not enough data available" );
+                    }
+                    
+                    buffered = static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent );
+                }
+                
+                buffered = std::min( buffered, size );
+                
+                memcpy( buf, this->_bufferCurrent, buffered );
+                
+                this->_bufferCurrent += buffered;
+                buf                  += buffered;
+                size                 -= buffered;
+            }
+        }
+        
+        void BinaryInflateStream::seek( ssize_t offset, SeekDirection dir )
+        {
+            size_t cur( this->tell() );
+            size_t pos;
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
+            
+            if( dir == SeekDirection::End )
+            {
+                throw std::runtime_error( "Invalid seek - Stream is forward-only" );
+            }
+            
+            if( dir == SeekDirection::Begin )
+            {
+                if( offset < 0 )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = numeric_cast< size_t >( offset );
+            }
+            else if( offset < 0 )
+            {
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
+            }
+            else
+            {
+                pos = cur + numeric_cast< size_t >( offset );
+            }
+            
+            if( pos < cur - static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin ) )
+            {
+                throw std::runtime_error( "Invalid seek - Stream is forward-only" );
+            }
+            
+            if( pos <= cur )
+            {
+                this->_bufferCurrent -= cur - pos;
+                
+                return;
+            }
+            
+            pos -= cur;
+            
+            while( pos > 0 )
+            {
+                size_t buffered( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+                
+                if( buffered == 0 )
+                {
+                    if( this->underflow() == false )
+                    {
+                        throw std::runtime_error( "Invalid seek offset" );
+                    }
+                    
+                    continue;
+                }
+                
+                buffered              = std::min( buffered, pos );
+                this->_bufferCurrent += buffered;
+                pos                  -= buffered;
+            }
+        }
+        
+        size_t BinaryInflateStream::tell() const
+        {
+            return this->impl->_pos - static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent );
+        }
+        
+        size_t BinaryInflateStream::size() const
+        {
+            throw std::runtime_error( "Invalid stream - Unknown size" );
+        }
+        
+        bool BinaryInflateStream::supports( Capability capability ) const
+        {
+            switch( capability )
+            {
+                case Capability::Size:           return false;
+                case Capability::Seek:           return false;
+                case Capability::Views:          return false;
+                case Capability::PositionalRead: return false;
+                case Capability::Refill:         return true;
+                case Capability::StableViews:    return false;
+            }
+            
+            return false;
+        }
+        
+        bool BinaryInflateStream::finished() const
+        {
+            return this->impl->_finished && this->_bufferCurrent == this->_bufferEnd;
+        }
+        
+        bool BinaryInflateStream::underflow()
+        {
+            size_t length;
+            
+            if( this->_bufferCurrent != this->_bufferEnd )
+            {
+                return true;
+            }
+            
+            this->impl->_output.resize( std::max( this->bufferSize(), defaultBufferSize ) );
+            
+            length = this->inflate( this->impl->_output.data(), this->impl->_output.size() );
+            
+            if( length == 0 )
+            {
+                return false;
+            }
+            
+            this->impl->_pos    += length;
+            this->_bufferBegin   = this->impl->_output.data();
+            this->_bufferCurrent = this->_bufferBegin;
+            this->_bufferEnd     = this->_bufferBegin + length;
+            
+            return true;
+        }
+        
+        size_t BinaryInflateStream::inflate( uint8_t * buf, size_t size )
+        {
+            z_stream & zs( this->impl->_zstream );
+            uInt       length( static_cast< uInt >( std::min( size, static_cast< size_t >( std::numeric_limits< uInt >::max() ) ) ) );
+            
+            zs.next_out  = buf;
+            zs.avail_out = length;
+            
+            while( this->impl->_finished == false && zs.avail_out > 0 )
+            {
+                int status;
+                
+                if( zs.avail_in == 0 && zs.avail_out < length )
+                {
+                    break;
+                }
+                
+                if( zs.avail_in == 0 && this->impl->fill() == false )
+                {
+                    throw std::runtime_error( "Invalid compressed data - Unexpected end of stream" );
+                }
+                
+                status = ::inflate( &zs, Z_NO_FLUSH );
+                
+                if( this->impl->_input.empty() )
+                {
+                    this->impl->_stream._bufferCurrent = zs.next_in;
+                }
+                
+                if( status != Z_OK && status != Z_BUF_ERROR && status != Z_STREAM_END )
+                {
+                    throw std::runtime_error( "Invalid compressed data" );
+                }
+                
+                if( status == Z_STREAM_END && this->impl->nextMember() == false )
+                {
+                    this->impl->_finished = true;
+                    
+                    if( zs.avail_in > 0 && this->impl->_input.empty() == false )
+                    {
+                        if( this->impl->_stream.supports( Capability::Seek ) == false )
+                        {
+                            throw std::runtime_error( "Invalid compressed stream - Cannot restore unconsumed input" );
+                        }
+                        
+                        this->impl->_stream.seek( -numeric_cast< ssize_t >( zs.avail_in ), SeekDirection::Current );
+                    }
+                }
+            }
+            
+            return static_cast< size_t >( zs.next_out - buf );
+        }
+        
+        BinaryInflateStream::IMPL::IMPL( BinaryStream & stream, Format format ):
+            _stream(     stream ),
+            _format(     format ),
+            _zstream(    {} ),
+            _finished(   false ),
+            _pos(        0 ),
+            _endianness( stream.preferredEndianness() )
+        {
+            int bits( 15 );
+            
+            switch( format )
+            {
+                case Format::Auto:    bits = 15 + 32; break;
+                case Format::Zlib:    bits = 15;      break;
+                case Format::Deflate: bits = -15;     break;
+                case Format::GZip:    bits = 15 + 16; break;
+            }
+            
+            if( inflateInit2( &( this->_zstream ), bits ) != Z_OK )
+            {
+                throw std::runtime_error( "Invalid compressed stream - Cannot initialize decompressor" );
+            }
+        }
+        
+        BinaryInflateStream::IMPL::~IMPL()
+        {
+            inflateEnd( &( this->_zstream ) );
+        }
+        
+        bool BinaryInflateStream::IMPL::fill()
+        {
+            size_t length;
+            
+            this->_input.clear();
+            
+            if( this->_stream.underflow() )
+            {
+                length = static_cast< size_t >( this->_stream._bufferEnd - this->_stream._bufferCurrent );
+                
+                this->_zstream.next_in  = const_cast< uint8_t * >( this->_stream._bufferCurrent );
+                this->_zstream.avail_in = static_cast< uInt >( std::min( length, static_cast< size_t >( std::numeric_limits< uInt >::max() ) ) );
+                
+                return true;
+            }
+            
+            if( this->_stream.supports( Capability::Size ) == false )
+            {
+                return false;
+            }
+            
+            length = std::min( this->_stream.availableBytes(), defaultBufferSize );
+            
+            if( length == 0 )
+            {
+                return false;
+            }
+            
+            this->_input.resize( length );
+            this->_stream.read( this->_input.data(), length );
+            
+            this->_zstream.next_in  = this->_input.data();
+            this->_zstream.avail_in = static_cast< uInt >( length );
+            
+            return true;
+        }
+        
+        bool BinaryInflateStream::IMPL::nextMember()
+        {
+            if( this->_format != Format::GZip && this->_format != Format::Auto )
+            {
+                return false;
+            }
+            
+            if( this->_zstream.avail_in == 0 && this->fill() == false )
+            {
+                return false;
+            }
+            
+            if( this->_zstream.next_in[ 0 ] != 0x1F || ( this->_zstream.avail_in > 1 && this->_zstream.next_in[ 1 ] != 0x8B ) )
+            {
+                return false;
+            }
+            
+            if( inflateReset( &( this->_zstream ) ) != Z_OK )
+            {
+                throw std::runtime_error( "Invalid compressed stream - Cannot reset decompressor" );
+            }
+            
+            return true;
+        }
+    }
+}
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryMappedFileStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <XS/IO/BinaryMappedFileStream.hpp>
+#include <XS/Casts.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BinaryMappedFileStream::IMPL
+        {
+            public:
+                
+                IMPL( const std::string & path );
+                ~IMPL();
+                
+                void advise( Access access, size_t offset, size_t length );
+                
+                std::string _path;
+                bool        _open;
+                uint8_t   * _data;
+                size_t      _size;
+                Endianness  _endianness;
+        };
+        
+        BinaryMappedFileStream::BinaryMappedFileStream( const std::string & path, Access access ):
+            impl( std::make_unique< IMPL >( path ) )
+        {
+            this->_bufferBegin   = this->impl->_data;
+            this->_bufferCurrent = this->impl->_data;
+            this->_bufferEnd     = this->impl->_data + this->impl->_size;
+            
+            if( access != Access::Normal )
+            {
+                this->advise( access );
+            }
+        }
+        
+        BinaryMappedFileStream::~BinaryMappedFileStream()
+        {}
+        
+        BinaryStream::Endianness BinaryMappedFileStream::preferredEndianness() const
+        {
+            return this->impl->_endianness;
+        }
+        
+        void BinaryMappedFileStream::setPreferredEndianness( Endianness value )
+        {
+            this->impl->_endianness = value;
+        }
+        
+        void BinaryMappedFileStream::read( uint8_t * buf, size_t size )
+        {
+            if( this->impl->_open == false )
+            {
+                throw std::runtime_error( "Invalid file stream" );
+            }
+            
+            if( size > static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            if( size == 0 )
+            {
+                return;
+            }
+            
+            memcpy( buf, this->_bufferCurrent, size );
+            
+            this->_bufferCurrent += size;
+        }
+        
+        void BinaryMappedFileStream::seek( ssize_t offset, SeekDirection dir )
+        {
+            size_t pos;
+            size_t cur( this->tell() );
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
+            
+            if( dir == SeekDirection::Begin )
+            {
+                if( offset < 0 )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = numeric_cast< size_t >( offset );
+            }
+            else if( dir == SeekDirection::End )
+            {
+                if( offset > 0 || distance > this->impl->_size )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = this->impl->_size - distance;
+            }
+            else if( offset < 0 )
+            {
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
+            }
+            else
+            {
+                pos = cur + numeric_cast< size_t >( offset );
+            }
+            
+            if( pos > this->impl->_size )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            this->_bufferCurrent = this->_bufferBegin + pos;
+        }
+        
+        size_t BinaryMappedFileStream::tell() const
+        {
+            if( this->impl->_open == false )
+            {
+                throw std::runtime_error( "Invalid file stream" );
+            }
+            
+            return static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin );
+        }
+        
+        size_t BinaryMappedFileStream::size() const
+        {
+            return this->impl->_size;
+        }
+        
+        bool BinaryMappedFileStream::supports( Capability capability ) const
+        {
+            switch( capability )
+            {
+                case Capability::Size:           return true;
+                case Capability::Seek:           return true;
+                case Capability::Views:          return true;
+                case Capability::PositionalRead: return true;
+                case Capability::Refill:         return false;
+                case Capability::StableViews:    return true;
+            }
+            
+            return false;
+        }
+        
+        void BinaryMappedFileStream::readAt( size_t offset, uint8_t * buf, size_t size ) const
+        {
+            if( this->impl->_open == false )
+            {
+                throw std::runtime_error( "Invalid file stream" );
+            }
+            
+            if( offset > this->impl->_size || size > this->impl->_size - offset )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            if( size > 0 )
+            {
+                memcpy( buf, this->impl->_data + offset, size );
+            }
+        }
+        
+        void BinaryMappedFileStream::advise( Access access )
+        {
+            this->impl->advise( access, 0, this->impl->_size );
+        }
+        
+        void BinaryMappedFileStream::advise( Access access, size_t offset, size_t length )
+        {
+            if( offset > this->impl->_size || length > this->impl->_size - offset )
+            {
+                throw std::runtime_error( "Invalid advice range" );
+            }
+            
+            this->impl->advise( access, offset, length );
+        }
+        
+        BinaryMappedFileStream::IMPL::IMPL( const std::string & path ):
+            _path(       path ),
+            _open(       false ),
+            _data(       nullptr ),
+            _size(       0 ),
+            _endianness( Endianness::Default )
+        {
+            int         fd( open( this->_path.c_str(), O_RDONLY ) );
+            struct stat st;
+            
+            if( fd == -1 )
+            {
+                return;
+            }
+            
+            if( fstat( fd, &st ) == 0 )
+            {
+                this->_size = numeric_cast< size_t >( st.st_size );
+                this->_open = true;
+            }
+            
+            if( this->_size > 0 )
+            {
+                void * data( mmap( nullptr, this->_size, PROT_READ, MAP_PRIVATE, fd, 0 ) );
+                
+                if( data == MAP_FAILED )
+                {
+                    this->_size = 0;
+                    this->_open = false;
+                }
+                else
+                {
+                    this->_data = static_cast< uint8_t * >( data );
+                }
+            }
+            
+            close( fd );
+        }
+        
+        BinaryMappedFileStream::IMPL::~IMPL()
+        {
+            if( this->_data != nullptr )
+            {
+                munmap( this->_data, this->_size );
+            }
+        }
+        
+        void BinaryMappedFileStream::IMPL::advise( Access access, size_t offset, size_t length )
+        {
+            size_t page( static_cast< size_t >( sysconf( _SC_PAGESIZE ) ) );
+            size_t start( offset - ( offset % page ) );
+            int    advice( MADV_NORMAL );
+            
+            if( this->_data == nullptr || length == 0 )
+            {
+                return;
+            }
+            
+            switch( access )
+            {
+                case Access::Normal:     advice = MADV_NORMAL;     break;
+                case Access::Sequential: advice = MADV_SEQUENTIAL; break;
+                case Access::Random:     advice = MADV_RANDOM;     break;
+                case Access::WillNeed:   advice = MADV_WILLNEED;   break;
+            }
+            
+            madvise( this->_data + start, length + ( offset - start ), advice );
+        }
+    }
+}
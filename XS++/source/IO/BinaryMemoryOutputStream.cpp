@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryMemoryOutputStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <cmath>
+#include <cstring>
+#include <XS/IO/BinaryMemoryOutputStream.hpp>
+#include <XS/Casts.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BinaryMemoryOutputStream::IMPL
+        {
+            public:
+                
+                IMPL( uint8_t * data, size_t size );
+                IMPL( const IMPL & o );
+                ~IMPL();
+                
+                uint8_t *  _data;
+                size_t     _size;
+                Endianness _endianness;
+        };
+        
+        BinaryMemoryOutputStream::BinaryMemoryOutputStream( uint8_t * data, size_t size ):
+            impl( std::make_unique< IMPL >( data, size ) )
+        {
+            this->_bufferBegin   = data;
+            this->_bufferCurrent = data;
+            this->_bufferEnd     = data + size;
+        }
+        
+        BinaryMemoryOutputStream::BinaryMemoryOutputStream( const BinaryMemoryOutputStream & o ):
+            BinaryOutputStream( o ),
+            impl( std::make_unique< IMPL >( *( o.impl ) ) )
+        {}
+        
+        BinaryMemoryOutputStream::BinaryMemoryOutputStream( BinaryMemoryOutputStream && o ) noexcept:
+            BinaryOutputStream( o ),
+            impl( std::move( o.impl ) )
+        {}
+        
+        BinaryMemoryOutputStream::~BinaryMemoryOutputStream()
+        {}
+        
+        BinaryMemoryOutputStream & BinaryMemoryOutputStream::operator =( BinaryMemoryOutputStream o )
+        {
+            swap( *( this ), o );
+            
+            return *( this );
+        }
+        
+        BinaryOutputStream::Endianness BinaryMemoryOutputStream::preferredEndianness() const
+        {
+            return this->impl->_endianness;
+        }
+        
+        void BinaryMemoryOutputStream::setPreferredEndianness( Endianness value )
+        {
+            this->impl->_endianness = value;
+        }
+        
+        void BinaryMemoryOutputStream::write( const uint8_t * buf, size_t size )
+        {
+            if( size == 0 )
+            {
+                return;
+            }
+            
+            if( size > static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) )
+            {
+                throw std::runtime_error( "Invalid write - Not enough space available" );
+            }
+            
+            memcpy( this->_bufferCurrent, buf, size );
+            
+            this->_bufferCurrent += size;
+        }
+        
+        void BinaryMemoryOutputStream::seek( ssize_t offset, SeekDirection dir )
+        {
+            size_t pos;
+            size_t cur( this->tell() );
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
+            
+            if( dir == SeekDirection::Begin )
+            {
+                if( offset < 0 )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = numeric_cast< size_t >( offset );
+            }
+            else if( dir == SeekDirection::End )
+            {
+                if( offset > 0 || distance > this->impl->_size )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = this->impl->_size - distance;
+            }
+            else if( offset < 0 )
+            {
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
+            }
+            else
+            {
+                pos = cur + numeric_cast< size_t >( offset );
+            }
+            
+            if( pos > this->impl->_size )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            this->_bufferCurrent = this->_bufferBegin + pos;
+        }
+        
+        size_t BinaryMemoryOutputStream::tell() const
+        {
+            return static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin );
+        }
+        
+        size_t BinaryMemoryOutputStream::size() const
+        {
+            return this->impl->_size;
+        }
+        
+        void swap( BinaryMemoryOutputStream & o1, BinaryMemoryOutputStream & o2 )
+        {
+            using std::swap;
+            
+            swap( o1.impl,           o2.impl );
+            swap( o1._bufferBegin,   o2._bufferBegin );
+            swap( o1._bufferCurrent, o2._bufferCurrent );
+            swap( o1._bufferEnd,     o2._bufferEnd );
+        }
+        
+        BinaryMemoryOutputStream::IMPL::IMPL( uint8_t * data, size_t size ):
+            _data(       data ),
+            _size(       size ),
+            _endianness( Endianness::Default )
+        {}
+        
+        BinaryMemoryOutputStream::IMPL::IMPL( const IMPL & o ):
+            _data(       o._data ),
+            _size(       o._size ),
+            _endianness( o._endianness )
+        {}
+        
+        BinaryMemoryOutputStream::IMPL::~IMPL()
+        {}
+    }
+}
@@ -29,7 +29,9 @@
 
 #include <fstream>
 #include <cmath>
+#include <cstring>
 #include <vector>
+#include <optional>
 #include <XS/IO/BinaryMemoryStream.hpp>
 #include <XS/Casts.hpp>
 
@@ -41,24 +43,42 @@ namespace XS
         {
             public:
 
-                IMPL( const uint8_t * data );
+                IMPL( const uint8_t * data, std::optional< size_t > size );
                 IMPL( const IMPL & o );
                 ~IMPL();
                 
-                const uint8_t * _data;
-                size_t          _pos;
-                Endianness      _endianness;
+                const uint8_t *         _data;
+                std::optional< size_t > _size;
+                Endianness              _endianness;
         };
         
         BinaryMemoryStream::BinaryMemoryStream( const uint8_t * data ):
-            impl( std::make_unique< IMPL >( data ) )
+            impl( std::make_unique< IMPL >( data, std::nullopt ) )
+        {
+            this->_bufferBegin   = data;
+            this->_bufferCurrent = data;
+            this->_bufferEnd     = data;
+        }
+        
+        BinaryMemoryStream::BinaryMemoryStream( const uint8_t * data, size_t size ):
+            impl( std::make_unique< IMPL >( data, size ) )
+        {
+            this->_bufferBegin   = data;
+            this->_bufferCurrent = data;
+            this->_bufferEnd     = data + size;
+        }
+        
+        BinaryMemoryStream::BinaryMemoryStream( std::span< const uint8_t > data ):
+            BinaryMemoryStream( data.data(), data.size() )
         {}
         
         BinaryMemoryStream::BinaryMemoryStream( const BinaryMemoryStream & o ):
+            BinaryStream( o ),
             impl( std::make_unique< IMPL >( *( o.impl ) ) )
         {}
         
         BinaryMemoryStream::BinaryMemoryStream( BinaryMemoryStream && o ) noexcept:
+            BinaryStream( o ),
             impl( std::move( o.impl ) )
         {}
         
@@ -88,15 +108,27 @@ namespace XS
             {
                 return;
             }
-
-            memcpy( buf, this->impl->_data + this->impl->_pos, size );
             
-            this->impl->_pos += size;
+            if( this->impl->_size.has_value() && size > static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            memcpy( buf, this->_bufferCurrent, size );
+            
+            this->_bufferCurrent += size;
+            
+            if( this->impl->_size.has_value() == false )
+            {
+                this->_bufferEnd = this->_bufferCurrent;
+            }
         }
         
         void BinaryMemoryStream::seek( ssize_t offset, SeekDirection dir )
         {
             size_t pos;
+            size_t cur( this->tell() );
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
             
             if( dir == SeekDirection::Begin )
             {
@@ -109,41 +141,107 @@ namespace XS
             }
             else if( dir == SeekDirection::End )
             {
-                throw std::runtime_error( "Invalid seek offset" );
+                if( this->impl->_size.has_value() == false || offset > 0 || distance > *this->impl->_size )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = *this->impl->_size - distance;
             }
             else if( offset < 0 )
             {
-                pos = this->impl->_pos - numeric_cast< size_t >( abs( offset ) );
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
             }
             else
             {
-                pos = this->impl->_pos + numeric_cast< size_t >( offset );
+                pos = cur + numeric_cast< size_t >( offset );
+            }
+            
+            if( this->impl->_size.has_value() && pos > *this->impl->_size )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
             }
             
-            this->impl->_pos = pos;
+            this->_bufferCurrent = this->_bufferBegin + pos;
+            
+            if( this->impl->_size.has_value() == false )
+            {
+                this->_bufferEnd = this->_bufferCurrent;
+            }
         }
         
         size_t BinaryMemoryStream::tell() const
         {
-            return this->impl->_pos;
+            return static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin );
+        }
+        
+        size_t BinaryMemoryStream::size() const
+        {
+            if( this->impl->_size.has_value() == false )
+            {
+                throw std::runtime_error( "Invalid stream - Unknown size" );
+            }
+            
+            return *this->impl->_size;
+        }
+        
+        bool BinaryMemoryStream::supports( Capability capability ) const
+        {
+            switch( capability )
+            {
+                case Capability::Size:           return this->impl->_size.has_value();
+                case Capability::Seek:           return true;
+                case Capability::Views:          return this->impl->_size.has_value();
+                case Capability::PositionalRead: return this->impl->_size.has_value();
+                case Capability::Refill:         return false;
+                case Capability::StableViews:    return this->impl->_size.has_value();
+            }
+            
+            return false;
+        }
+        
+        void BinaryMemoryStream::readAt( size_t offset, uint8_t * buf, size_t size ) const
+        {
+            if( this->impl->_size.has_value() == false )
+            {
+                throw std::runtime_error( "Invalid read - Stream does not support positional reads" );
+            }
+            
+            if( offset > *this->impl->_size || size > *this->impl->_size - offset )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            if( size > 0 )
+            {
+                memcpy( buf, this->impl->_data + offset, size );
+            }
         }
         
         void swap( BinaryMemoryStream & o1, BinaryMemoryStream & o2 )
         {
             using std::swap;
             
-            swap( o1.impl, o2.impl );
+            swap( o1.impl,           o2.impl );
+            swap( o1._bufferBegin,   o2._bufferBegin );
+            swap( o1._bufferCurrent, o2._bufferCurrent );
+            swap( o1._bufferEnd,     o2._bufferEnd );
         }
         
-        BinaryMemoryStream::IMPL::IMPL( const uint8_t * data ):
+        BinaryMemoryStream::IMPL::IMPL( const uint8_t * data, std::optional< size_t > size ):
             _data(       data ),
-            _pos(        0 ),
+            _size(       size ),
             _endianness( Endianness::Default )
         {}
         
         BinaryMemoryStream::IMPL::IMPL( const IMPL & o ):
             _data(       o._data ),
-            _pos(        o._pos ),
+            _size(       o._size ),
             _endianness( o._endianness )
         {}
         
@@ -0,0 +1,292 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryOutputStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <XS/IO/BinaryOutputStream.hpp>
+#include <XS/IO/ByteSwap.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace
+        {
+            bool NeedsByteSwap( BinaryOutputStream::Endianness endianness )
+            {
+                if( endianness == BinaryOutputStream::Endianness::BigEndian )
+                {
+                    return std::endian::native != std::endian::big;
+                }
+                else if( endianness == BinaryOutputStream::Endianness::LittleEndian )
+                {
+                    return std::endian::native != std::endian::little;
+                }
+                
+                return false;
+            }
+            
+            template< typename _T_, typename _U_ >
+            void WriteArray( BinaryOutputStream & stream, const _T_ * values, size_t count, BinaryOutputStream::Endianness endianness, void ( * swap )( _U_ *, size_t ) )
+            {
+                static_assert( sizeof( _T_ ) == sizeof( _U_ ), "Invalid byte swap function" );
+                
+                if( count == 0 )
+                {
+                    return;
+                }
+                
+                if( count > std::numeric_limits< size_t >::max() / sizeof( _T_ ) )
+                {
+                    throw std::runtime_error( "Invalid write - Too many values" );
+                }
+                
+                if( NeedsByteSwap( endianness ) == false )
+                {
+                    stream.write( reinterpret_cast< const uint8_t * >( values ), count * sizeof( _T_ ) );
+                    
+                    return;
+                }
+                
+                {
+                    _U_ buf[ 4096 / sizeof( _U_ ) ];
+                    
+                    while( count > 0 )
+                    {
+                        size_t n( std::min( count, sizeof( buf ) / sizeof( _U_ ) ) );
+                        
+                        memcpy( buf, values, n * sizeof( _T_ ) );
+                        swap( buf, n );
+                        stream.write( reinterpret_cast< const uint8_t * >( buf ), n * sizeof( _T_ ) );
+                        
+                        values += n;
+                        count  -= n;
+                    }
+                }
+            }
+        }
+        
+        void BinaryOutputStream::flush()
+        {}
+        
+        size_t BinaryOutputStream::bufferSize() const
+        {
+            return this->_bufferSize;
+        }
+        
+        void BinaryOutputStream::setBufferSize( size_t size )
+        {
+            this->_bufferSize = size;
+        }
+        
+        void BinaryOutputStream::seek( ssize_t offset )
+        {
+            this->seek( offset, SeekDirection::Current );
+        }
+        
+        void BinaryOutputStream::write( const std::vector< uint8_t > & data )
+        {
+            this->write( data.data(), data.size() );
+        }
+        
+        void BinaryOutputStream::writeUInt8( uint8_t value )
+        {
+            this->write( value );
+        }
+        
+        void BinaryOutputStream::writeInt8( int8_t value )
+        {
+            this->write( value );
+        }
+        
+        void BinaryOutputStream::writeUInt16( uint16_t value )
+        {
+            this->write( value );
+        }
+        
+        void BinaryOutputStream::writeBigEndianUInt16( uint16_t value )
+        {
+            this->writeBigEndian( value );
+        }
+        
+        void BinaryOutputStream::writeLittleEndianUInt16( uint16_t value )
+        {
+            this->writeLittleEndian( value );
+        }
+        
+        void BinaryOutputStream::writeUInt32( uint32_t value )
+        {
+            this->write( value );
+        }
+        
+        void BinaryOutputStream::writeBigEndianUInt32( uint32_t value )
+        {
+            this->writeBigEndian( value );
+        }
+        
+        void BinaryOutputStream::writeLittleEndianUInt32( uint32_t value )
+        {
+            this->writeLittleEndian( value );
+        }
+        
+        void BinaryOutputStream::writeUInt64( uint64_t value )
+        {
+            this->write( value );
+        }
+        
+        void BinaryOutputStream::writeBigEndianUInt64( uint64_t value )
+        {
+            this->writeBigEndian( value );
+        }
+        
+        void BinaryOutputStream::writeLittleEndianUInt64( uint64_t value )
+        {
+            this->writeLittleEndian( value );
+        }
+        
+        void BinaryOutputStream::writeUInt16( const uint16_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::Swap16 );
+        }
+        
+        void BinaryOutputStream::writeBigEndianUInt16( const uint16_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::Swap16 );
+        }
+        
+        void BinaryOutputStream::writeLittleEndianUInt16( const uint16_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::Swap16 );
+        }
+        
+        void BinaryOutputStream::writeUInt32( const uint32_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::Swap32 );
+        }
+        
+        void BinaryOutputStream::writeBigEndianUInt32( const uint32_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::Swap32 );
+        }
+        
+        void BinaryOutputStream::writeLittleEndianUInt32( const uint32_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::Swap32 );
+        }
+        
+        void BinaryOutputStream::writeUInt64( const uint64_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::Swap64 );
+        }
+        
+        void BinaryOutputStream::writeBigEndianUInt64( const uint64_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::Swap64 );
+        }
+        
+        void BinaryOutputStream::writeLittleEndianUInt64( const uint64_t * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::Swap64 );
+        }
+        
+        void BinaryOutputStream::writeFloat( const float * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::Swap32 );
+        }
+        
+        void BinaryOutputStream::writeBigEndianFloat( const float * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::Swap32 );
+        }
+        
+        void BinaryOutputStream::writeLittleEndianFloat( const float * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::Swap32 );
+        }
+        
+        void BinaryOutputStream::writeDouble( const double * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::Swap64 );
+        }
+        
+        void BinaryOutputStream::writeBigEndianDouble( const double * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::Swap64 );
+        }
+        
+        void BinaryOutputStream::writeLittleEndianDouble( const double * values, size_t count )
+        {
+            WriteArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::Swap64 );
+        }
+        
+        void BinaryOutputStream::writePascalString( const std::string & value )
+        {
+            if( value.length() > std::numeric_limits< uint8_t >::max() )
+            {
+                throw std::runtime_error( "Invalid string - Maximum length exceeded" );
+            }
+            
+            this->writeUInt8( static_cast< uint8_t >( value.length() ) );
+            this->writeBuffered( reinterpret_cast< const uint8_t * >( value.data() ), value.length() );
+        }
+        
+        void BinaryOutputStream::writeString( const std::string & value, size_t length )
+        {
+            static const uint8_t zero[ 64 ] = {};
+            size_t               n( std::min( length, value.length() ) );
+            
+            this->writeBuffered( reinterpret_cast< const uint8_t * >( value.data() ), n );
+            
+            while( n < length )
+            {
+                size_t pad( std::min( length - n, sizeof( zero ) ) );
+                
+                this->writeBuffered( zero, pad );
+                
+                n += pad;
+            }
+        }
+        
+        void BinaryOutputStream::writeNULLTerminatedString( const std::string & value )
+        {
+            this->writeBuffered( reinterpret_cast< const uint8_t * >( value.c_str() ), value.length() + 1 );
+        }
+        
+        void BinaryOutputStream::writeNULLTerminatedUTF16String( const std::u16string & value )
+        {
+            WriteArray( *( this ), value.c_str(), value.length() + 1, this->preferredEndianness(), ByteSwap::Swap16 );
+        }
+        
+        bool BinaryOutputStream::overflow()
+        {
+            return false;
+        }
+    }
+}
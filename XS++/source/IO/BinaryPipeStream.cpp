@@ -0,0 +1,341 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryPipeStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <atomic>
+#include <algorithm>
+#include <bit>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include <XS/IO/BinaryPipeStream.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        class BinaryPipeStream::IMPL
+        {
+            public:
+                
+                IMPL( size_t capacity );
+                ~IMPL();
+                
+                template< typename _F_ >
+                void wait( _F_ ready );
+                void notify();
+                
+                std::vector< uint8_t > _ring;
+                size_t                 _mask;
+                Endianness             _endianness;
+                
+                char                    _padding0[ 64 ];
+                std::atomic< size_t >   _head;
+                size_t                  _writePosition;
+                
+                char                    _padding1[ 64 ];
+                std::atomic< size_t >   _tail;
+                size_t                  _readPosition;
+                
+                char                    _padding2[ 64 ];
+                std::atomic< bool >     _closed;
+                std::atomic< size_t >   _waiters;
+                std::mutex              _mutex;
+                std::condition_variable _condition;
+        };
+        
+        BinaryPipeStream::BinaryPipeStream( size_t capacity ):
+            impl( std::make_unique< IMPL >( capacity ) )
+        {}
+        
+        BinaryPipeStream::~BinaryPipeStream()
+        {}
+        
+        BinaryStream::Endianness BinaryPipeStream::preferredEndianness() const
+        {
+            return this->impl->_endianness;
+        }
+        
+        void BinaryPipeStream::setPreferredEndianness( Endianness value )
+        {
+            this->impl->_endianness = value;
+        }
+        
+        void BinaryPipeStream::read( uint8_t * buf, size_t size )
+        {
+            while( size > 0 )
+            {
+                size_t length( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+                
+                if( length == 0 )
+                {
+                    if( this->refill( true ) == false )
+                    {
+                        throw std::runtime_error( "Invalid read - Not enough data available" );
+                    }
+                    
+                    continue;
+                }
+                
+                length = std::min( length, size );
+                
+                memcpy( buf, this->_bufferCurrent, length );
+                
+                this->_bufferCurrent += length;
+                buf                  += length;
+                size                 -= length;
+            }
+        }
+        
+        void BinaryPipeStream::seek( ssize_t offset, SeekDirection dir )
+        {
+            ( void )offset;
+            ( void )dir;
+            
+            throw std::runtime_error( "Invalid stream - Seek is not supported" );
+        }
+        
+        size_t BinaryPipeStream::tell() const
+        {
+            return this->impl->_readPosition + static_cast< size_t >( this->_bufferCurrent - this->_bufferBegin );
+        }
+        
+        size_t BinaryPipeStream::size() const
+        {
+            throw std::runtime_error( "Invalid stream - Unknown size" );
+        }
+        
+        bool BinaryPipeStream::supports( Capability capability ) const
+        {
+            switch( capability )
+            {
+                case Capability::Size:           return false;
+                case Capability::Seek:           return false;
+                case Capability::Views:          return false;
+                case Capability::PositionalRead: return false;
+                case Capability::Refill:         return true;
+                case Capability::StableViews:    return false;
+            }
+            
+            return false;
+        }
+        
+        size_t BinaryPipeStream::tryRead( uint8_t * buf, size_t size )
+        {
+            size_t read( 0 );
+            
+            while( read < size )
+            {
+                size_t length( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+                
+                if( length == 0 )
+                {
+                    if( this->refill( false ) == false )
+                    {
+                        break;
+                    }
+                    
+                    continue;
+                }
+                
+                length = std::min( length, size - read );
+                
+                memcpy( buf + read, this->_bufferCurrent, length );
+                
+                this->_bufferCurrent += length;
+                read                 += length;
+            }
+            
+            this->impl->_tail.store( this->tell() );
+            this->impl->notify();
+            
+            return read;
+        }
+        
+        size_t BinaryPipeStream::readableBytes() const
+        {
+            return this->impl->_head.load( std::memory_order_acquire ) - this->tell();
+        }
+        
+        size_t BinaryPipeStream::capacity() const
+        {
+            return this->impl->_ring.size();
+        }
+        
+        bool BinaryPipeStream::isClosed() const
+        {
+            return this->impl->_closed.load( std::memory_order_acquire );
+        }
+        
+        void BinaryPipeStream::write( const uint8_t * buf, size_t size )
+        {
+            while( size > 0 )
+            {
+                size_t length( this->tryWrite( buf, size ) );
+                
+                if( length == 0 )
+                {
+                    this->impl->wait( [ this ] { return this->impl->_closed.load() || this->impl->_writePosition - this->impl->_tail.load() < this->impl->_ring.size(); } );
+                    
+                    continue;
+                }
+                
+
+                buf   += length;
+                size  -= length;
+            }
+        }
+        
+        size_t BinaryPipeStream::tryWrite( const uint8_t * buf, size_t size )
+        {
+            size_t head( this->impl->_writePosition );
+            size_t tail( this->impl->_tail.load( std::memory_order_acquire ) );
+            size_t offset( head & this->impl->_mask );
+            size_t length( std::min( size, this->impl->_ring.size() - ( head - tail ) ) );
+            size_t first( std::min( length, this->impl->_ring.size() - offset ) );
+            
+            if( this->isClosed() )
+            {
+                throw std::runtime_error( "Invalid write - Pipe is closed" );
+            }
+            
+            if( length == 0 )
+            {
+                return 0;
+            }
+            
+            memcpy( this->impl->_ring.data() + offset, buf, first );
+            memcpy( this->impl->_ring.data(), buf + first, length - first );
+            
+            this->impl->_writePosition += length;
+            
+            this->impl->_head.store( this->impl->_writePosition );
+            this->impl->notify();
+            
+            return length;
+        }
+        
+        void BinaryPipeStream::close()
+        {
+            this->impl->_closed.store( true );
+            
+            {
+                std::lock_guard< std::mutex > lock( this->impl->_mutex );
+            }
+            
+            this->impl->_condition.notify_all();
+        }
+        
+        bool BinaryPipeStream::underflow()
+        {
+            if( this->_bufferCurrent != this->_bufferEnd )
+            {
+                return true;
+            }
+            
+            return this->refill( true );
+        }
+        
+        bool BinaryPipeStream::refill( bool wait )
+        {
+            size_t position( this->tell() );
+            size_t head;
+            size_t offset;
+            
+            this->impl->_readPosition = position;
+            this->_bufferBegin        = nullptr;
+            this->_bufferCurrent      = nullptr;
+            this->_bufferEnd          = nullptr;
+            
+            this->impl->_tail.store( position );
+            this->impl->notify();
+            
+            head = this->impl->_head.load( std::memory_order_acquire );
+            
+            if( head == position && wait )
+            {
+                this->impl->wait( [ & ] { return this->impl->_head.load() != position || this->impl->_closed.load(); } );
+                
+                head = this->impl->_head.load( std::memory_order_acquire );
+            }
+            
+            if( head == position )
+            {
+                return false;
+            }
+            
+            offset = position & this->impl->_mask;
+            
+            this->_bufferBegin   = this->impl->_ring.data() + offset;
+            this->_bufferCurrent = this->_bufferBegin;
+            this->_bufferEnd     = this->_bufferBegin + std::min( head - position, this->impl->_ring.size() - offset );
+            
+            return true;
+        }
+        
+        BinaryPipeStream::IMPL::IMPL( size_t capacity ):
+            _ring(          std::bit_ceil( std::max( capacity, static_cast< size_t >( 64 ) ) ) ),
+            _mask(          _ring.size() - 1 ),
+            _endianness(    Endianness::Default ),
+            _head(          0 ),
+            _writePosition( 0 ),
+            _tail(          0 ),
+            _readPosition(  0 ),
+            _closed(        false ),
+            _waiters(       0 )
+        {}
+        
+        BinaryPipeStream::IMPL::~IMPL()
+        {}
+        
+        template< typename _F_ >
+        void BinaryPipeStream::IMPL::wait( _F_ ready )
+        {
+            std::unique_lock< std::mutex > lock( this->_mutex );
+            
+            this->_waiters.fetch_add( 1 );
+            this->_condition.wait( lock, ready );
+            this->_waiters.fetch_sub( 1 );
+        }
+        
+        void BinaryPipeStream::IMPL::notify()
+        {
+            if( this->_waiters.load() == 0 )
+            {
+                return;
+            }
+            
+            {
+                std::lock_guard< std::mutex > lock( this->_mutex );
+            }
+            
+            this->_condition.notify_all();
+        }
+    }
+}
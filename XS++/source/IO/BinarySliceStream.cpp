@@ -0,0 +1,350 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinarySliceStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <cstring>
+#include <vector>
+#include <XS/IO/BinarySliceStream.hpp>
+#include <XS/Casts.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace
+        {
+            constexpr size_t defaultBufferSize( 4096 );
+        }
+        
+        class BinarySliceStream::IMPL
+        {
+            public:
+                
+                IMPL( const BinaryStream & stream, size_t offset, size_t length );
+                IMPL( const IMPL & o );
+                ~IMPL();
+                
+                const BinaryStream   & _stream;
+                const uint8_t        * _data;
+                size_t                 _offset;
+                size_t                 _length;
+                size_t                 _pos;
+                Endianness             _endianness;
+                std::vector< uint8_t > _buffer;
+        };
+        
+        BinarySliceStream::BinarySliceStream( const BinaryStream & stream, size_t offset, size_t length ):
+            impl( std::make_unique< IMPL >( stream, offset, length ) )
+        {
+            if( stream.supports( Capability::Size ) == false || offset > stream.size() || length > stream.size() - offset )
+            {
+                throw std::runtime_error( "Invalid slice range" );
+            }
+            
+            if( stream.supports( Capability::StableViews ) )
+            {
+                size_t start( stream.tell() - static_cast< size_t >( stream._bufferCurrent - stream._bufferBegin ) );
+                size_t end( start + static_cast< size_t >( stream._bufferEnd - stream._bufferBegin ) );
+                
+                if( stream._bufferBegin != nullptr && offset >= start && offset + length <= end )
+                {
+                    this->impl->_data    = stream._bufferBegin + ( offset - start );
+                    this->impl->_pos     = length;
+                    this->_bufferBegin   = this->impl->_data;
+                    this->_bufferCurrent = this->impl->_data;
+                    this->_bufferEnd     = this->impl->_data + length;
+                    
+                    return;
+                }
+            }
+            
+            if( stream.supports( Capability::PositionalRead ) == false )
+            {
+                throw std::runtime_error( "Invalid stream - Slices are not supported" );
+            }
+        }
+        
+        BinarySliceStream::BinarySliceStream( const BinarySliceStream & o ):
+            impl( std::make_unique< IMPL >( *( o.impl ) ) )
+        {
+            if( this->impl->_data != nullptr )
+            {
+                this->_bufferBegin   = o._bufferBegin;
+                this->_bufferCurrent = o._bufferCurrent;
+                this->_bufferEnd     = o._bufferEnd;
+            }
+            else
+            {
+                this->impl->_pos = o.tell();
+            }
+        }
+        
+        BinarySliceStream::BinarySliceStream( BinarySliceStream && o ) noexcept:
+            BinaryStream( o ),
+            impl( std::move( o.impl ) )
+        {
+            o._bufferBegin   = nullptr;
+            o._bufferCurrent = nullptr;
+            o._bufferEnd     = nullptr;
+        }
+        
+        BinarySliceStream::~BinarySliceStream()
+        {}
+        
+        BinarySliceStream & BinarySliceStream::operator =( BinarySliceStream o )
+        {
+            swap( *( this ), o );
+            
+            return *( this );
+        }
+        
+        BinaryStream::Endianness BinarySliceStream::preferredEndianness() const
+        {
+            return this->impl->_endianness;
+        }
+        
+        void BinarySliceStream::setPreferredEndianness( Endianness value )
+        {
+            this->impl->_endianness = value;
+        }
+        
+        void BinarySliceStream::read( uint8_t * buf, size_t size )
+        {
+            size_t pos( this->tell() );
+            
+            if( size > this->impl->_length - pos )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            while( size > 0 )
+            {
+                size_t buffered( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+                
+                if( buffered == 0 && this->impl->_data == nullptr && size >= std::max( this->bufferSize(), defaultBufferSize ) )
+                {
+                    pos = this->tell();
+                    
+                    this->impl->_stream.readAt( this->impl->_offset + pos, buf, size );
+                    
+                    this->_bufferBegin   = nullptr;
+                    this->_bufferCurrent = nullptr;
+                    this->_bufferEnd     = nullptr;
+                    this->impl->_pos     = pos + size;
+                    
+                    return;
+                }
+                
+                if( buffered == 0 )
+                {
+                    this->underflow();
+                    
+                    buffered = static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent );
+                }
+                
+                buffered = std::min( buffered, size );
+                
+                memcpy( buf, this->_bufferCurrent, buffered );
+                
+                this->_bufferCurrent += buffered;
+                buf                  += buffered;
+                size                 -= buffered;
+            }
+        }
+        
+        void BinarySliceStream::seek( ssize_t offset, SeekDirection dir )
+        {
+            size_t pos;
+            size_t cur( this->tell() );
+            size_t distance( ( offset < 0 ) ? 0 - static_cast< size_t >( offset ) : static_cast< size_t >( offset ) );
+            
+            if( dir == SeekDirection::Begin )
+            {
+                if( offset < 0 )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = numeric_cast< size_t >( offset );
+            }
+            else if( dir == SeekDirection::End )
+            {
+                if( offset > 0 || distance > this->impl->_length )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = this->impl->_length - distance;
+            }
+            else if( offset < 0 )
+            {
+                if( distance > cur )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                pos = cur - distance;
+            }
+            else
+            {
+                pos = cur + numeric_cast< size_t >( offset );
+            }
+            
+            if( pos > this->impl->_length )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            {
+                size_t start( this->impl->_pos - static_cast< size_t >( this->_bufferEnd - this->_bufferBegin ) );
+                
+                if( this->_bufferBegin != nullptr && pos >= start && pos <= this->impl->_pos )
+                {
+                    this->_bufferCurrent = this->_bufferBegin + ( pos - start );
+                    
+                    return;
+                }
+            }
+            
+            this->_bufferBegin   = nullptr;
+            this->_bufferCurrent = nullptr;
+            this->_bufferEnd     = nullptr;
+            this->impl->_pos     = pos;
+        }
+        
+        size_t BinarySliceStream::tell() const
+        {
+            return this->impl->_pos - static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent );
+        }
+        
+        size_t BinarySliceStream::size() const
+        {
+            return this->impl->_length;
+        }
+        
+        bool BinarySliceStream::supports( Capability capability ) const
+        {
+            switch( capability )
+            {
+                case Capability::Size:           return true;
+                case Capability::Seek:           return true;
+                case Capability::Views:          return this->impl->_data != nullptr;
+                case Capability::PositionalRead: return true;
+                case Capability::Refill:         return false;
+                case Capability::StableViews:    return this->impl->_data != nullptr;
+            }
+            
+            return false;
+        }
+        
+        void BinarySliceStream::readAt( size_t offset, uint8_t * buf, size_t size ) const
+        {
+            if( offset > this->impl->_length || size > this->impl->_length - offset )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            if( size == 0 )
+            {
+                return;
+            }
+            
+            if( this->impl->_data != nullptr )
+            {
+                memcpy( buf, this->impl->_data + offset, size );
+            }
+            else
+            {
+                this->impl->_stream.readAt( this->impl->_offset + offset, buf, size );
+            }
+        }
+        
+        size_t BinarySliceStream::offset() const
+        {
+            return this->impl->_offset;
+        }
+        
+        bool BinarySliceStream::underflow()
+        {
+            size_t length;
+            
+            if( this->_bufferCurrent != this->_bufferEnd )
+            {
+                return true;
+            }
+            
+            if( this->impl->_data != nullptr || this->impl->_pos == this->impl->_length )
+            {
+                return false;
+            }
+            
+            length = std::min( std::max( this->bufferSize(), defaultBufferSize ), this->impl->_length - this->impl->_pos );
+            
+            this->impl->_buffer.resize( std::max( this->bufferSize(), defaultBufferSize ) );
+            this->impl->_stream.readAt( this->impl->_offset + this->impl->_pos, this->impl->_buffer.data(), length );
+            
+            this->impl->_pos    += length;
+            this->_bufferBegin   = this->impl->_buffer.data();
+            this->_bufferCurrent = this->_bufferBegin;
+            this->_bufferEnd     = this->_bufferBegin + length;
+            
+            return true;
+        }
+        
+        void swap( BinarySliceStream & o1, BinarySliceStream & o2 )
+        {
+            using std::swap;
+            
+            swap( o1.impl,           o2.impl );
+            swap( o1._bufferBegin,   o2._bufferBegin );
+            swap( o1._bufferCurrent, o2._bufferCurrent );
+            swap( o1._bufferEnd,     o2._bufferEnd );
+        }
+        
+        BinarySliceStream::IMPL::IMPL( const BinaryStream & stream, size_t offset, size_t length ):
+            _stream(     stream ),
+            _data(       nullptr ),
+            _offset(     offset ),
+            _length(     length ),
+            _pos(        0 ),
+            _endianness( stream.preferredEndianness() )
+        {}
+        
+        BinarySliceStream::IMPL::IMPL( const IMPL & o ):
+            _stream(     o._stream ),
+            _data(       o._data ),
+            _offset(     o._offset ),
+            _length(     o._length ),
+            _pos(        o._pos ),
+            _endianness( o._endianness )
+        {}
+        
+        BinarySliceStream::IMPL::~IMPL()
+        {}
+    }
+}
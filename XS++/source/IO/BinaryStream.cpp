@@ -29,14 +29,134 @@
 
 #include <fstream>
 #include <cmath>
+#include <bit>
+#include <limits>
 #include <XS/IO/BinaryStream.hpp>
+#include <XS/IO/BinarySliceStream.hpp>
+#include <XS/IO/ByteSwap.hpp>
+#include <XS/IO/Varint.hpp>
+#include <XS/IO/BitPacking.hpp>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
 
 namespace XS
 {
     namespace IO
     {
+        namespace
+        {
+            bool NeedsByteSwap( BinaryStream::Endianness endianness )
+            {
+                if( endianness == BinaryStream::Endianness::BigEndian )
+                {
+                    return std::endian::native != std::endian::big;
+                }
+                else if( endianness == BinaryStream::Endianness::LittleEndian )
+                {
+                    return std::endian::native != std::endian::little;
+                }
+                
+                return false;
+            }
+            
+            size_t FindUTF16Terminator( const uint8_t * data, size_t count )
+            {
+                size_t i( 0 );
+                
+                #if defined( __SSE2__ )
+                {
+                    const __m128i zero( _mm_setzero_si128() );
+                    
+                    for( ; i + 8 <= count; i += 8 )
+                    {
+                        __m128i v( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ( i * 2 ) ) ) );
+                        int     mask( _mm_movemask_epi8( _mm_cmpeq_epi16( v, zero ) ) );
+                        
+                        if( mask != 0 )
+                        {
+                            return i + static_cast< size_t >( __builtin_ctz( static_cast< unsigned int >( mask ) ) / 2 );
+                        }
+                    }
+                }
+                #elif defined( __ARM_NEON ) && defined( __aarch64__ )
+                for( ; i + 8 <= count; i += 8 )
+                {
+                    uint16x8_t v( vreinterpretq_u16_u8( vld1q_u8( data + ( i * 2 ) ) ) );
+                    
+                    if( vmaxvq_u16( vceqzq_u16( v ) ) != 0 )
+                    {
+                        break;
+                    }
+                }
+                #endif
+                
+                for( ; i < count; i++ )
+                {
+                    if( data[ i * 2 ] == 0 && data[ ( i * 2 ) + 1 ] == 0 )
+                    {
+                        return i;
+                    }
+                }
+                
+                return count;
+            }
+            
+            template< typename _T_ >
+            void ReadArray( BinaryStream & stream, _T_ * values, size_t count, BinaryStream::Endianness endianness, void ( * swap )( uint8_t *, size_t ) )
+            {
+                uint8_t * data( reinterpret_cast< uint8_t * >( values ) );
+                
+                if( count == 0 )
+                {
+                    return;
+                }
+                
+                if( count > std::numeric_limits< size_t >::max() / sizeof( _T_ ) )
+                {
+                    throw std::runtime_error( "Invalid read - Too many values" );
+                }
+                
+                stream.read( data, count * sizeof( _T_ ) );
+                
+                if( NeedsByteSwap( endianness ) )
+                {
+                    swap( data, count );
+                }
+            }
+            
+            template< typename _T_ >
+            _T_ ReadVarint( BinaryStream & stream, size_t ( * decode )( const uint8_t *, size_t, _T_ & ) )
+            {
+                uint8_t buf[ 10 ];
+                size_t  length( 0 );
+                _T_     value;
+                
+                do
+                {
+                    buf[ length ] = stream.readUInt8();
+                }
+                while( ( buf[ length++ ] & 0x80 ) != 0 && length < sizeof( buf ) );
+                
+                if( decode( buf, length, value ) == 0 )
+                {
+                    throw std::runtime_error( "Invalid varint - Value too large" );
+                }
+                
+                return value;
+            }
+        }
+        
         bool BinaryStream::hasBytesAvailable()
         {
+            if( this->supports( Capability::Refill ) )
+            {
+                return this->_bufferCurrent != this->_bufferEnd || this->underflow();
+            }
+            
             return this->availableBytes() > 0;
         }
         
@@ -45,6 +165,13 @@ namespace XS
             size_t cur( this->tell() );
             size_t pos;
             
+            if( this->supports( Capability::Size ) )
+            {
+                pos = this->size();
+                
+                return ( pos > cur ) ? pos - cur : 0;
+            }
+            
             this->seek( 0, SeekDirection::End );
             
             pos = this->tell();
@@ -54,6 +181,25 @@ namespace XS
             return pos - cur;
         }
         
+        void BinaryStream::readAt( size_t offset, uint8_t * buf, size_t size ) const
+        {
+            ( void )offset;
+            ( void )buf;
+            ( void )size;
+            
+            throw std::runtime_error( "Invalid read - Stream does not support positional reads" );
+        }
+        
+        size_t BinaryStream::bufferSize() const
+        {
+            return this->_bufferSize;
+        }
+        
+        void BinaryStream::setBufferSize( size_t size )
+        {
+            this->_bufferSize = size;
+        }
+        
         void BinaryStream::seek( ssize_t offset )
         {
             this->seek( offset, SeekDirection::Current );
@@ -75,293 +221,206 @@ namespace XS
         
         std::vector< uint8_t > BinaryStream::readAll()
         {
-            return this->read( this->availableBytes() );
-        }
-        
-        uint8_t BinaryStream::readUInt8()
-        {
-            uint8_t n;
+            std::vector< uint8_t > data;
             
-            n = 0;
+            if( this->supports( Capability::Refill ) == false )
+            {
+                return this->read( this->availableBytes() );
+            }
             
-            this->read( reinterpret_cast< uint8_t * >( &n ), 1 );
+            while( this->_bufferCurrent != this->_bufferEnd || this->underflow() )
+            {
+                data.insert( data.end(), this->_bufferCurrent, this->_bufferEnd );
+                
+                this->_bufferCurrent = this->_bufferEnd;
+            }
             
-            return n;
+            return data;
         }
         
-        int8_t BinaryStream::readInt8()
+        std::span< const uint8_t > BinaryStream::readView( size_t size )
         {
-            int8_t n;
+            std::span< const uint8_t > view;
             
-            n = 0;
+            if( this->supports( Capability::Views ) == false )
+            {
+                throw std::runtime_error( "Invalid read - Stream does not support views" );
+            }
             
-            this->read( reinterpret_cast< uint8_t * >( &n ), 1 );
+            if( size > static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
             
-            return n;
+            view                  = std::span< const uint8_t >( this->_bufferCurrent, size );
+            this->_bufferCurrent += size;
+            
+            return view;
         }
         
-        uint16_t BinaryStream::readUInt16()
+        std::string_view BinaryStream::readStringView( size_t length )
         {
-            if( this->preferredEndianness() == Endianness::LittleEndian )
-            {
-                return this->readLittleEndianUInt16();
-            }
-            else if( this->preferredEndianness() == Endianness::BigEndian )
+            std::span< const uint8_t > view( this->readView( length ) );
+            const void               * end;
+            
+            if( view.empty() )
             {
-                return this->readBigEndianUInt16();
+                return {};
             }
-            else
+            
+            end = memchr( view.data(), 0, view.size() );
+            
+            if( end != nullptr )
             {
-                uint16_t n;
-                
-                n = 0;
-                
-                this->read( reinterpret_cast< uint8_t * >( &n ), 2 );
-                
-                return n;
+                length = static_cast< size_t >( static_cast< const uint8_t * >( end ) - view.data() );
             }
+            
+            return std::string_view( reinterpret_cast< const char * >( view.data() ), length );
+        }
+        
+        BinarySliceStream BinaryStream::slice( size_t offset, size_t length ) const
+        {
+            return BinarySliceStream( *( this ), offset, length );
+        }
+        
+        uint8_t BinaryStream::readUInt8()
+        {
+            return this->read< uint8_t >();
+        }
+        
+        int8_t BinaryStream::readInt8()
+        {
+            return this->read< int8_t >();
+        }
+        
+        uint16_t BinaryStream::readUInt16()
+        {
+            return this->read< uint16_t >();
         }
         
         uint16_t BinaryStream::readBigEndianUInt16()
         {
-            uint8_t  c[ 2 ];
-            uint16_t n;
-            uint16_t n1;
-            uint16_t n2;
-            
-            c[ 0 ] = 0;
-            c[ 1 ] = 0;
-            
-            this->read( reinterpret_cast< uint8_t * >( c ), 2 );
-            
-            n1 = numeric_cast< uint16_t >( c[ 0 ] );
-            n2 = numeric_cast< uint16_t >( c[ 1 ] );
-            
-            n  = numeric_cast< uint16_t >( n1 << 8 )
-               | n2;
-            
-            return n;
+            return this->readBigEndian< uint16_t >();
         }
         
         uint16_t BinaryStream::readLittleEndianUInt16()
         {
-            uint8_t  c[ 2 ];
-            uint16_t n;
-            uint16_t n1;
-            uint16_t n2;
-            
-            c[ 0 ] = 0;
-            c[ 1 ] = 0;
-            
-            this->read( reinterpret_cast< uint8_t * >( c ), 2 );
-            
-            n1 = numeric_cast< uint16_t >( c[ 1 ] );
-            n2 = numeric_cast< uint16_t >( c[ 0 ] );
-            
-            n  = numeric_cast< uint16_t >( n1 << 8 )
-               | n2;
-            
-            return n;
+            return this->readLittleEndian< uint16_t >();
         }
         
         uint32_t BinaryStream::readUInt32()
         {
-            if( this->preferredEndianness() == Endianness::LittleEndian )
-            {
-                return this->readLittleEndianUInt32();
-            }
-            else if( this->preferredEndianness() == Endianness::BigEndian )
-            {
-                return this->readBigEndianUInt32();
-            }
-            else
-            {
-                uint32_t n;
-                
-                n = 0;
-                
-                this->read( reinterpret_cast< uint8_t * >( &n ), 4 );
-                
-                return n;
-            }
+            return this->read< uint32_t >();
         }
         
         uint32_t BinaryStream::readBigEndianUInt32()
         {
-            uint8_t  c[ 4 ];
-            uint32_t n;
-            uint32_t n1;
-            uint32_t n2;
-            uint32_t n3;
-            uint32_t n4;
-            
-            c[ 0 ] = 0;
-            c[ 1 ] = 0;
-            c[ 2 ] = 0;
-            c[ 3 ] = 0;
-            
-            this->read( reinterpret_cast< uint8_t * >( c ), 4 );
-            
-            n1 = numeric_cast< uint32_t >( c[ 0 ] );
-            n2 = numeric_cast< uint32_t >( c[ 1 ] );
-            n3 = numeric_cast< uint32_t >( c[ 2 ] );
-            n4 = numeric_cast< uint32_t >( c[ 3 ] );
-            
-            n  = numeric_cast< uint32_t >( n1 << 24 )
-               | numeric_cast< uint32_t >( n2 << 16 )
-               | numeric_cast< uint32_t >( n3 << 8 )
-               | n4;
-            
-            return n;
+            return this->readBigEndian< uint32_t >();
         }
         
         uint32_t BinaryStream::readLittleEndianUInt32()
         {
-            uint8_t  c[ 4 ];
-            uint32_t n;
-            uint32_t n1;
-            uint32_t n2;
-            uint32_t n3;
-            uint32_t n4;
-            
-            c[ 0 ] = 0;
-            c[ 1 ] = 0;
-            c[ 2 ] = 0;
-            c[ 3 ] = 0;
-            
-            this->read( reinterpret_cast< uint8_t * >( c ), 4 );
-            
-            n1 = numeric_cast< uint32_t >( c[ 3 ] );
-            n2 = numeric_cast< uint32_t >( c[ 2 ] );
-            n3 = numeric_cast< uint32_t >( c[ 1 ] );
-            n4 = numeric_cast< uint32_t >( c[ 0 ] );
-            
-            n  = numeric_cast< uint32_t >( n1 << 24 )
-               | numeric_cast< uint32_t >( n2 << 16 )
-               | numeric_cast< uint32_t >( n3 << 8 )
-               | n4;
-            
-            return n;
+            return this->readLittleEndian< uint32_t >();
         }
         
         uint64_t BinaryStream::readUInt64()
         {
-            if( this->preferredEndianness() == Endianness::LittleEndian )
-            {
-                return this->readLittleEndianUInt64();
-            }
-            else if( this->preferredEndianness() == Endianness::BigEndian )
-            {
-                return this->readBigEndianUInt64();
-            }
-            else
-            {
-                uint64_t n;
-                
-                n = 0;
-                
-                this->read( reinterpret_cast< uint8_t * >( &n ), 8 );
-                
-                return n;
-            }
+            return this->read< uint64_t >();
         }
         
         uint64_t BinaryStream::readBigEndianUInt64()
         {
-            uint8_t  c[ 8 ];
-            uint64_t n;
-            uint64_t n1;
-            uint64_t n2;
-            uint64_t n3;
-            uint64_t n4;
-            uint64_t n5;
-            uint64_t n6;
-            uint64_t n7;
-            uint64_t n8;
-            
-            c[ 0 ] = 0;
-            c[ 1 ] = 0;
-            c[ 2 ] = 0;
-            c[ 3 ] = 0;
-            c[ 4 ] = 0;
-            c[ 5 ] = 0;
-            c[ 6 ] = 0;
-            c[ 7 ] = 0;
-            
-            this->read( reinterpret_cast< uint8_t * >( c ), 8 );
-            
-            n1 = numeric_cast< uint64_t >( c[ 0 ] );
-            n2 = numeric_cast< uint64_t >( c[ 1 ] );
-            n3 = numeric_cast< uint64_t >( c[ 2 ] );
-            n4 = numeric_cast< uint64_t >( c[ 3 ] );
-            n5 = numeric_cast< uint64_t >( c[ 4 ] );
-            n6 = numeric_cast< uint64_t >( c[ 5 ] );
-            n7 = numeric_cast< uint64_t >( c[ 6 ] );
-            n8 = numeric_cast< uint64_t >( c[ 7 ] );
-            
-            n  = numeric_cast< uint64_t >( n1 << 56 )
-               | numeric_cast< uint64_t >( n2 << 48 )
-               | numeric_cast< uint64_t >( n3 << 40 )
-               | numeric_cast< uint64_t >( n4 << 32 )
-               | numeric_cast< uint64_t >( n5 << 24 )
-               | numeric_cast< uint64_t >( n6 << 16 )
-               | numeric_cast< uint64_t >( n7 << 8 )
-               | n8;
-            
-            return n;
+            return this->readBigEndian< uint64_t >();
         }
         
         uint64_t BinaryStream::readLittleEndianUInt64()
         {
-            uint8_t  c[ 8 ];
-            uint64_t n;
-            uint64_t n1;
-            uint64_t n2;
-            uint64_t n3;
-            uint64_t n4;
-            uint64_t n5;
-            uint64_t n6;
-            uint64_t n7;
-            uint64_t n8;
-            
-            c[ 0 ] = 0;
-            c[ 1 ] = 0;
-            c[ 2 ] = 0;
-            c[ 3 ] = 0;
-            c[ 4 ] = 0;
-            c[ 5 ] = 0;
-            c[ 6 ] = 0;
-            c[ 7 ] = 0;
-            
-            this->read( reinterpret_cast< uint8_t * >( c ), 8 );
-            
-            n1 = numeric_cast< uint64_t >( c[ 7 ] );
-            n2 = numeric_cast< uint64_t >( c[ 6 ] );
-            n3 = numeric_cast< uint64_t >( c[ 5 ] );
-            n4 = numeric_cast< uint64_t >( c[ 4 ] );
-            n5 = numeric_cast< uint64_t >( c[ 3 ] );
-            n6 = numeric_cast< uint64_t >( c[ 2 ] );
-            n7 = numeric_cast< uint64_t >( c[ 1 ] );
-            n8 = numeric_cast< uint64_t >( c[ 0 ] );
-            
-            n  = numeric_cast< uint64_t >( n1 << 56 )
-               | numeric_cast< uint64_t >( n2 << 48 )
-               | numeric_cast< uint64_t >( n3 << 40 )
-               | numeric_cast< uint64_t >( n4 << 32 )
-               | numeric_cast< uint64_t >( n5 << 24 )
-               | numeric_cast< uint64_t >( n6 << 16 )
-               | numeric_cast< uint64_t >( n7 << 8 )
-               | n8;
-            
-            return n;
+            return this->readLittleEndian< uint64_t >();
+        }
+        
+        void BinaryStream::readUInt16( uint16_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::SwapBytes16 );
+        }
+        
+        void BinaryStream::readBigEndianUInt16( uint16_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::SwapBytes16 );
+        }
+        
+        void BinaryStream::readLittleEndianUInt16( uint16_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::SwapBytes16 );
+        }
+        
+        void BinaryStream::readUInt32( uint32_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::SwapBytes32 );
+        }
+        
+        void BinaryStream::readBigEndianUInt32( uint32_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::SwapBytes32 );
+        }
+        
+        void BinaryStream::readLittleEndianUInt32( uint32_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::SwapBytes32 );
+        }
+        
+        void BinaryStream::readUInt64( uint64_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::SwapBytes64 );
+        }
+        
+        void BinaryStream::readBigEndianUInt64( uint64_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::SwapBytes64 );
+        }
+        
+        void BinaryStream::readLittleEndianUInt64( uint64_t * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::SwapBytes64 );
+        }
+        
+        void BinaryStream::readFloat( float * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::SwapBytes32 );
+        }
+        
+        void BinaryStream::readBigEndianFloat( float * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::SwapBytes32 );
+        }
+        
+        void BinaryStream::readLittleEndianFloat( float * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::SwapBytes32 );
+        }
+        
+        void BinaryStream::readDouble( double * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, this->preferredEndianness(), ByteSwap::SwapBytes64 );
+        }
+        
+        void BinaryStream::readBigEndianDouble( double * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::BigEndian, ByteSwap::SwapBytes64 );
+        }
+        
+        void BinaryStream::readLittleEndianDouble( double * values, size_t count )
+        {
+            ReadArray( *( this ), values, count, Endianness::LittleEndian, ByteSwap::SwapBytes64 );
         }
         
         float BinaryStream::readBigEndianFixedPoint( unsigned int integerLength, unsigned int fractionalLength )
         {
-            uint32_t     n;
-            unsigned int integer;
-            unsigned int fractionalMask;
-            unsigned int fractional;
+            uint32_t n;
+            
+            if( fractionalLength > 32 )
+            {
+                throw std::runtime_error( "Invalid fixed point format" );
+            }
             
             if( integerLength + fractionalLength == 16 )
             {
@@ -372,19 +431,17 @@ namespace XS
                 n = this->readBigEndianUInt32();
             }
             
-            integer        = n >> fractionalLength;
-            fractionalMask = numeric_cast< unsigned int >( pow( 2, fractionalLength ) - 1 );
-            fractional     = ( n & fractionalMask ) / ( 1 << fractionalLength );
-            
-            return integer + fractional;
+            return static_cast< float >( n ) * ( 1.0f / static_cast< float >( uint64_t( 1 ) << fractionalLength ) );
         }
         
         float BinaryStream::readLittleEndianFixedPoint( unsigned int integerLength, unsigned int fractionalLength )
         {
-            uint32_t     n;
-            unsigned int integer;
-            unsigned int fractionalMask;
-            unsigned int fractional;
+            uint32_t n;
+            
+            if( fractionalLength > 32 )
+            {
+                throw std::runtime_error( "Invalid fixed point format" );
+            }
             
             if( integerLength + fractionalLength == 16 )
             {
@@ -395,11 +452,108 @@ namespace XS
                 n = this->readLittleEndianUInt32();
             }
             
-            integer        = n >> fractionalLength;
-            fractionalMask = numeric_cast< unsigned int >( pow( 2, fractionalLength ) - 1 );
-            fractional     = ( n & fractionalMask ) / ( 1 << fractionalLength );
+            return static_cast< float >( n ) * ( 1.0f / static_cast< float >( uint64_t( 1 ) << fractionalLength ) );
+        }
+        
+        uint64_t BinaryStream::readULEB128()
+        {
+            uint64_t value;
+            size_t   length( Varint::Decode( this->_bufferCurrent, static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ), value ) );
             
-            return integer + fractional;
+            if( length == 0 )
+            {
+                return ReadVarint< uint64_t >( *( this ), Varint::Decode );
+            }
+            
+            this->_bufferCurrent += length;
+            
+            return value;
+        }
+        
+        int64_t BinaryStream::readSLEB128()
+        {
+            int64_t value;
+            size_t  length( Varint::DecodeSigned( this->_bufferCurrent, static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ), value ) );
+            
+            if( length == 0 )
+            {
+                return ReadVarint< int64_t >( *( this ), Varint::DecodeSigned );
+            }
+            
+            this->_bufferCurrent += length;
+            
+            return value;
+        }
+        
+        uint64_t BinaryStream::readVarint()
+        {
+            return this->readULEB128();
+        }
+        
+        void BinaryStream::readULEB128( uint32_t * values, size_t count )
+        {
+            this->readULEB128Array( values, count );
+        }
+        
+        void BinaryStream::readULEB128( uint64_t * values, size_t count )
+        {
+            this->readULEB128Array( values, count );
+        }
+        
+        template< typename _T_ >
+        void BinaryStream::readULEB128Array( _T_ * values, size_t count )
+        {
+            constexpr size_t maxLength( ( ( sizeof( _T_ ) * 8 ) + 6 ) / 7 );
+            
+            while( count > 0 )
+            {
+                size_t available( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+                size_t n( std::min( count, available / maxLength ) );
+                
+                if( n == 0 )
+                {
+                    *( values ) = ReadVarint< _T_ >( *( this ), Varint::Decode );
+                    n           = 1;
+                }
+                else
+                {
+                    this->_bufferCurrent += Varint::Decode( this->_bufferCurrent, available, values, n );
+                }
+                
+                values += n;
+                count  -= n;
+            }
+        }
+        
+        void BinaryStream::readBitPacked( uint32_t * values, size_t count, unsigned int width )
+        {
+            size_t                 length( BitPacking::PackedSize( count, width ) );
+            size_t                 available( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+            std::vector< uint8_t > buf;
+            
+            if( length <= available )
+            {
+                BitPacking::Unpack( this->_bufferCurrent, available, values, count, width );
+                
+                this->_bufferCurrent += length;
+                
+                return;
+            }
+            
+            buf.resize( BitPacking::PackedSize( std::min( count, static_cast< size_t >( 4096 ) ), width ) );
+            
+            while( count > 0 )
+            {
+                size_t n( std::min( count, static_cast< size_t >( 4096 ) ) );
+                
+                length = BitPacking::PackedSize( n, width );
+                
+                this->read( buf.data(), length );
+                BitPacking::Unpack( buf.data(), length, values, n, width );
+                
+                values += n;
+                count  -= n;
+            }
         }
         
         std::string BinaryStream::readPascalString()
@@ -423,42 +577,134 @@ namespace XS
         
         std::string BinaryStream::readString( size_t length )
         {
-            std::vector< char > cp( length + 1, 0 );
+            std::string s;
+            
+            if( length == 0 )
+            {
+                return s;
+            }
+            
+            if( this->supports( Capability::Views ) )
+            {
+                return std::string( this->readStringView( length ) );
+            }
+            
+            s = std::string( length, 0 );
             
-            this->read( reinterpret_cast< uint8_t * >( &( cp[ 0 ] ) ), length );
+            this->read( reinterpret_cast< uint8_t * >( &( s[ 0 ] ) ), length );
+            s.resize( strnlen( s.data(), length ) );
             
-            return &( cp[ 0 ] );
+            return s;
         }
         
-        std::string BinaryStream::readNULLTerminatedString()
+        std::string BinaryStream::readNULLTerminatedString( size_t maxLength )
         {
             char        c;
             std::string s;
             
+            while( 1 )
+            {
+                size_t          available( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) );
+                const uint8_t * end;
+                size_t          length;
+                
+                if( available == 0 )
+                {
+                    if( this->underflow() )
+                    {
+                        continue;
+                    }
+                    
+                    break;
+                }
+                
+                end    = static_cast< const uint8_t * >( memchr( this->_bufferCurrent, 0, available ) );
+                length = ( end == nullptr ) ? available : static_cast< size_t >( end - this->_bufferCurrent );
+                
+                if( length > maxLength - s.length() )
+                {
+                    throw std::runtime_error( "Invalid string - Maximum length exceeded" );
+                }
+                
+                s.append( reinterpret_cast< const char * >( this->_bufferCurrent ), length );
+                
+                this->_bufferCurrent += length;
+                
+                if( end != nullptr )
+                {
+                    this->_bufferCurrent++;
+                    
+                    return s;
+                }
+            }
+            
             while( 1 )
             {
                 c = 0;
                 
-                this->read( reinterpret_cast< uint8_t * >( &c ), 1 );
+                this->readBuffered( reinterpret_cast< uint8_t * >( &c ), 1 );
                 
                 if( c == 0 )
                 {
                     break;
                 }
                 
+                if( s.length() == maxLength )
+                {
+                    throw std::runtime_error( "Invalid string - Maximum length exceeded" );
+                }
+                
                 s.append( 1, c );
             }
             
             return s;
         }
         
-        std::u16string BinaryStream::readNULLTerminatedUTF16String()
+        std::u16string BinaryStream::readNULLTerminatedUTF16String( size_t maxLength )
         {
             char16_t       c;
             std::u16string s;
+            bool           swap( NeedsByteSwap( this->preferredEndianness() ) );
             
             while( 1 )
             {
+                size_t count( static_cast< size_t >( this->_bufferEnd - this->_bufferCurrent ) / 2 );
+                
+                if( count > 0 )
+                {
+                    size_t length( FindUTF16Terminator( this->_bufferCurrent, count ) );
+                    size_t pos( s.length() );
+                    
+                    if( length > maxLength - pos )
+                    {
+                        throw std::runtime_error( "Invalid string - Maximum length exceeded" );
+                    }
+                    
+                    s.resize( pos + length );
+                    memcpy( &( s[ pos ] ), this->_bufferCurrent, length * 2 );
+                    
+                    if( swap )
+                    {
+                        ByteSwap::SwapBytes16( reinterpret_cast< uint8_t * >( &( s[ pos ] ) ), length );
+                    }
+                    
+                    this->_bufferCurrent += length * 2;
+                    
+                    if( length < count )
+                    {
+                        this->_bufferCurrent += 2;
+                        
+                        return s;
+                    }
+                    
+                    continue;
+                }
+                
+                if( this->_bufferCurrent == this->_bufferEnd && this->underflow() )
+                {
+                    continue;
+                }
+                
                 c = this->readUInt16();
                 
                 if( c == 0x0000 )
@@ -466,10 +712,20 @@ namespace XS
                     break;
                 }
                 
+                if( s.length() == maxLength )
+                {
+                    throw std::runtime_error( "Invalid string - Maximum length exceeded" );
+                }
+                
                 s.append( 1, c );
             }
             
             return s;
         }
+        
+        bool BinaryStream::underflow()
+        {
+            return false;
+        }
     }
 }
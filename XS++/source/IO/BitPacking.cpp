@@ -0,0 +1,317 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BitPacking.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <XS/IO/BitPacking.hpp>
+#include "PrefixSum.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace BitPacking
+        {
+            namespace
+            {
+                constexpr size_t       chunkSize( 1024 );
+                constexpr unsigned int maxShuffleWidth( 25 );
+                
+                #if defined( __AVX2__ ) || ( defined( __ARM_NEON ) && defined( __aarch64__ ) )
+                
+                struct UnpackTable
+                {
+                    uint8_t  shuffle[ 32 ];
+                    uint32_t shift[ 8 ];
+                };
+                
+                constexpr std::array< UnpackTable, maxShuffleWidth + 1 > MakeUnpackTables()
+                {
+                    std::array< UnpackTable, maxShuffleWidth + 1 > tables {};
+                    
+                    for( unsigned int width( 1 ); width <= maxShuffleWidth; width++ )
+                    {
+                        for( unsigned int i( 0 ); i < 8; i++ )
+                        {
+                            unsigned int base( ( i < 4 ) ? 0 : ( 4 * width ) / 8 );
+                            unsigned int bit( i * width );
+                            
+                            for( unsigned int j( 0 ); j < 4; j++ )
+                            {
+                                tables[ width ].shuffle[ ( i * 4 ) + j ] = static_cast< uint8_t >( ( bit / 8 ) - base + j );
+                            }
+                            
+                            tables[ width ].shift[ i ] = bit % 8;
+                        }
+                    }
+                    
+                    return tables;
+                }
+                
+                constexpr std::array< UnpackTable, maxShuffleWidth + 1 > unpackTables( MakeUnpackTables() );
+                
+                #endif
+                
+                uint32_t Load32( const uint8_t * data )
+                {
+                    uint32_t value;
+                    
+                    memcpy( &value, data, sizeof( value ) );
+                    
+                    if constexpr( std::endian::native != std::endian::little )
+                    {
+                        value = __builtin_bswap32( value );
+                    }
+                    
+                    return value;
+                }
+                
+                template< unsigned int _W_ >
+                void UnpackBlock( const uint8_t * data, uint32_t * values )
+                {
+                    constexpr uint64_t mask( ( uint64_t( 1 ) << _W_ ) - 1 );
+                    uint64_t           buffer( 0 );
+                    unsigned int       available( 0 );
+                    
+                    for( unsigned int i( 0 ); i < 32; i++ )
+                    {
+                        if( available < _W_ )
+                        {
+                            buffer    |= static_cast< uint64_t >( Load32( data ) ) << available;
+                            data      += 4;
+                            available += 32;
+                        }
+                        
+                        values[ i ]  = static_cast< uint32_t >( buffer & mask );
+                        buffer     >>= _W_;
+                        available   -= _W_;
+                    }
+                }
+                
+                template< size_t ... _W_ >
+                constexpr std::array< void ( * )( const uint8_t *, uint32_t * ), sizeof ... ( _W_ ) > MakeUnpackBlocks( std::index_sequence< _W_ ... > )
+                {
+                    return { { &UnpackBlock< static_cast< unsigned int >( _W_ ) > ... } };
+                }
+                
+                constexpr auto unpackBlocks( MakeUnpackBlocks( std::make_index_sequence< 33 >() ) );
+                
+                size_t UnpackSIMD( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width )
+                {
+                    size_t i( 0 );
+                    
+                    if( width == 0 || width > maxShuffleWidth )
+                    {
+                        return 0;
+                    }
+                    
+                    #if defined( __AVX2__ )
+                    {
+                        const UnpackTable & table( unpackTables[ width ] );
+                        const __m256i       shuffle( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( table.shuffle ) ) );
+                        const __m256i       shift(   _mm256_loadu_si256( reinterpret_cast< const __m256i * >( table.shift ) ) );
+                        const __m256i       mask(    _mm256_set1_epi32( static_cast< int >( ( uint32_t( 1 ) << width ) - 1 ) ) );
+                        const size_t        half( ( 4 * width ) / 8 );
+                        size_t              pos( 0 );
+                        
+                        for( ; i + 8 <= count && size - pos >= half + 16; i += 8 )
+                        {
+                            __m128i lo( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + pos ) ) );
+                            __m128i hi( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + pos + half ) ) );
+                            __m256i v(  _mm256_inserti128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+                            
+                            v = _mm256_shuffle_epi8( v, shuffle );
+                            v = _mm256_srlv_epi32( v, shift );
+                            v = _mm256_and_si256( v, mask );
+                            
+                            _mm256_storeu_si256( reinterpret_cast< __m256i * >( values + i ), v );
+                            
+                            pos += width;
+                        }
+                    }
+                    #elif defined( __ARM_NEON ) && defined( __aarch64__ )
+                    {
+                        const UnpackTable & table( unpackTables[ width ] );
+                        const uint8x16_t    shuffleLo( vld1q_u8( table.shuffle ) );
+                        const uint8x16_t    shuffleHi( vld1q_u8( table.shuffle + 16 ) );
+                        const int32x4_t     shiftLo( vnegq_s32( vreinterpretq_s32_u32( vld1q_u32( table.shift ) ) ) );
+                        const int32x4_t     shiftHi( vnegq_s32( vreinterpretq_s32_u32( vld1q_u32( table.shift + 4 ) ) ) );
+                        const uint32x4_t    mask( vdupq_n_u32( ( uint32_t( 1 ) << width ) - 1 ) );
+                        const size_t        half( ( 4 * width ) / 8 );
+                        size_t              pos( 0 );
+                        
+                        for( ; i + 8 <= count && size - pos >= half + 16; i += 8 )
+                        {
+                            uint32x4_t lo( vreinterpretq_u32_u8( vqtbl1q_u8( vld1q_u8( data + pos ),        shuffleLo ) ) );
+                            uint32x4_t hi( vreinterpretq_u32_u8( vqtbl1q_u8( vld1q_u8( data + pos + half ), shuffleHi ) ) );
+                            
+                            vst1q_u32( values + i,     vandq_u32( vshlq_u32( lo, shiftLo ), mask ) );
+                            vst1q_u32( values + i + 4, vandq_u32( vshlq_u32( hi, shiftHi ), mask ) );
+                            
+                            pos += width;
+                        }
+                    }
+                    #else
+                    ( void )data;
+                    ( void )size;
+                    ( void )values;
+                    ( void )count;
+                    #endif
+                    
+                    return i;
+                }
+                
+                void UnpackTail( const uint8_t * data, uint32_t * values, size_t count, unsigned int width )
+                {
+                    uint64_t     mask( ( uint64_t( 1 ) << width ) - 1 );
+                    uint64_t     buffer( 0 );
+                    unsigned int available( 0 );
+                    
+                    for( size_t i( 0 ); i < count; i++ )
+                    {
+                        while( available < width )
+                        {
+                            buffer    |= static_cast< uint64_t >( *( data++ ) ) << available;
+                            available += 8;
+                        }
+                        
+                        values[ i ]  = static_cast< uint32_t >( buffer & mask );
+                        buffer     >>= width;
+                        available   -= width;
+                    }
+                }
+                
+                void UnpackChunk( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width )
+                {
+                    size_t i( UnpackSIMD( data, size, values, count, width ) );
+                    
+                    data += ( i / 8 ) * width;
+                    
+                    for( ; i + 32 <= count; i += 32 )
+                    {
+                        unpackBlocks[ width ]( data, values + i );
+                        
+                        data += 4 * width;
+                    }
+                    
+                    UnpackTail( data, values + i, count - i, width );
+                }
+                
+                void AddReference( uint32_t * values, size_t count, uint32_t reference )
+                {
+                    for( size_t i( 0 ); i < count; i++ )
+                    {
+                        values[ i ] += reference;
+                    }
+                }
+                
+                template< typename _F_ >
+                size_t UnpackChunks( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width, _F_ f )
+                {
+                    size_t length( PackedSize( count, width ) );
+                    
+                    if( length > size )
+                    {
+                        throw std::runtime_error( "Invalid bit-packed data - Not enough data available" );
+                    }
+                    
+                    for( size_t i( 0 ); i < count; i += chunkSize )
+                    {
+                        size_t n( std::min( chunkSize, count - i ) );
+                        
+                        UnpackChunk( data, size, values + i, n, width );
+                        f( values + i, n );
+                        
+                        data += ( chunkSize / 8 ) * width;
+                        size -= std::min( size, ( chunkSize / 8 ) * width );
+                    }
+                    
+                    return length;
+                }
+            }
+            
+            size_t PackedSize( size_t count, unsigned int width )
+            {
+                if( width > 32 )
+                {
+                    throw std::runtime_error( "Invalid bit width" );
+                }
+                
+                if( width > 0 && count > std::numeric_limits< size_t >::max() / width )
+                {
+                    throw std::runtime_error( "Invalid read - Too many values" );
+                }
+                
+                return ( ( count * width ) + 7 ) / 8;
+            }
+            
+            size_t Unpack( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width )
+            {
+                return UnpackChunks( data, size, values, count, width, []( uint32_t *, size_t ) {} );
+            }
+            
+            size_t UnpackFrameOfReference( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width, uint32_t reference )
+            {
+                return UnpackChunks
+                (
+                    data, size, values, count, width,
+                    [ & ]( uint32_t * chunk, size_t n )
+                    {
+                        AddReference( chunk, n, reference );
+                    }
+                );
+            }
+            
+            size_t UnpackDelta( const uint8_t * data, size_t size, uint32_t * values, size_t count, unsigned int width, uint32_t previous )
+            {
+                return UnpackChunks
+                (
+                    data, size, values, count, width,
+                    [ & ]( uint32_t * chunk, size_t n )
+                    {
+                        previous = Internal::PrefixSum( chunk, n, previous );
+                    }
+                );
+            }
+        }
+    }
+}
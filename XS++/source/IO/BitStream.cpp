@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BitStream.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <XS/IO/BitStream.hpp>
+#include <XS/Casts.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace XS
+{
+    namespace IO
+    {
+        BitStream::BitStream( BinaryStream & stream, BitOrder order ):
+            _stream( stream ),
+            _order(  order ),
+            _bits(   0 ),
+            _count(  0 )
+        {}
+        
+        BinaryStream & BitStream::stream() const
+        {
+            return this->_stream;
+        }
+        
+        BitStream::BitOrder BitStream::order() const
+        {
+            return this->_order;
+        }
+        
+        void BitStream::skipBits( size_t count )
+        {
+            size_t bytes;
+            
+            if( count <= this->_count )
+            {
+                this->consume( static_cast< unsigned int >( count ) );
+                
+                return;
+            }
+            
+            count       -= this->_count;
+            bytes        = count / 8;
+            this->_bits  = 0;
+            this->_count = 0;
+            
+            if( bytes > 0 && this->_stream.supports( BinaryStream::Capability::Seek ) )
+            {
+                this->_stream.seek( numeric_cast< ssize_t >( bytes ), BinaryStream::SeekDirection::Current );
+            }
+            else
+            {
+                uint8_t buf[ 256 ];
+                
+                while( bytes > 0 )
+                {
+                    size_t length( std::min( bytes, sizeof( buf ) ) );
+                    
+                    this->_stream.read( buf, length );
+                    
+                    bytes -= length;
+                }
+            }
+            
+            this->readBits( static_cast< unsigned int >( count % 8 ) );
+        }
+        
+        void BitStream::alignToByte()
+        {
+            this->consume( this->_count % 8 );
+        }
+        
+        void BitStream::release()
+        {
+            size_t bytes( this->_count / 8 );
+            
+            if( bytes > 0 )
+            {
+                if( this->_stream.supports( BinaryStream::Capability::Seek ) == false )
+                {
+                    throw std::runtime_error( "Invalid stream - Seek is not supported" );
+                }
+                
+                this->_stream.seek( -numeric_cast< ssize_t >( bytes ), BinaryStream::SeekDirection::Current );
+            }
+            
+            this->_bits  = 0;
+            this->_count = 0;
+        }
+        
+        uint64_t BitStream::readExpGolomb()
+        {
+            unsigned int zeros( 0 );
+            
+            while( true )
+            {
+                unsigned int n;
+                
+                if( this->_count == 0 )
+                {
+                    this->refill( 1 );
+                }
+                
+                n = static_cast< unsigned int >( ( this->_order == BitOrder::LSBFirst ) ? std::countr_zero( this->_bits ) : std::countl_zero( this->_bits ) );
+                
+                if( n < this->_count )
+                {
+                    zeros += n;
+                    
+                    this->consume( n + 1 );
+                    
+                    break;
+                }
+                
+                zeros       += this->_count;
+                this->_bits  = 0;
+                this->_count = 0;
+                
+                if( zeros > 63 )
+                {
+                    throw std::runtime_error( "Invalid Exp-Golomb code" );
+                }
+            }
+            
+            if( zeros > 63 )
+            {
+                throw std::runtime_error( "Invalid Exp-Golomb code" );
+            }
+            
+            return ( ( uint64_t( 1 ) << zeros ) | this->readBits( zeros ) ) - 1;
+        }
+        
+        int64_t BitStream::readSignedExpGolomb()
+        {
+            uint64_t n( this->readExpGolomb() );
+            
+            if( ( n & 1 ) != 0 )
+            {
+                return static_cast< int64_t >( ( n >> 1 ) + 1 );
+            }
+            
+            return -static_cast< int64_t >( n >> 1 );
+        }
+        
+        void BitStream::refill( unsigned int count )
+        {
+            BinaryStream & stream( this->_stream );
+            uint8_t        data[ 8 ] = {};
+            uint64_t       word;
+            unsigned int   bytes;
+            
+            if( stream._bufferEnd - stream._bufferCurrent >= 8 )
+            {
+                unsigned int total;
+                
+                bytes = ( 63 - this->_count ) / 8;
+                total = this->_count + ( bytes * 8 );
+                
+                memcpy( &word, stream._bufferCurrent, sizeof( word ) );
+                
+                if( this->_order == BitOrder::LSBFirst )
+                {
+                    if constexpr( std::endian::native != std::endian::little )
+                    {
+                        word = ByteSwap::Swap( word );
+                    }
+                    
+                    this->_bits |= ( word << this->_count ) & ( ( uint64_t( 1 ) << total ) - 1 );
+                }
+                else
+                {
+                    if constexpr( std::endian::native != std::endian::big )
+                    {
+                        word = ByteSwap::Swap( word );
+                    }
+                    
+                    this->_bits |= ( word >> this->_count ) & ( ~uint64_t( 0 ) << ( 64 - total ) );
+                }
+                
+                stream._bufferCurrent += bytes;
+                this->_count           = total;
+                
+                return;
+            }
+            
+            bytes = ( count - this->_count + 7 ) / 8;
+            
+            stream.read( data, bytes );
+            memcpy( &word, data, sizeof( word ) );
+            
+            if( this->_order == BitOrder::LSBFirst )
+            {
+                if constexpr( std::endian::native != std::endian::little )
+                {
+                    word = ByteSwap::Swap( word );
+                }
+                
+                this->_bits |= word << this->_count;
+            }
+            else
+            {
+                if constexpr( std::endian::native != std::endian::big )
+                {
+                    word = ByteSwap::Swap( word );
+                }
+                
+                this->_bits |= word >> this->_count;
+            }
+            
+            this->_count += bytes * 8;
+        }
+        
+        uint64_t BitStream::readLongBits( unsigned int count )
+        {
+            uint64_t hi;
+            uint64_t lo;
+            
+            if( count > 64 )
+            {
+                throw std::runtime_error( "Invalid bit count" );
+            }
+            
+            if( this->_order == BitOrder::LSBFirst )
+            {
+                lo = this->readBits( 32 );
+                hi = this->readBits( count - 32 );
+            }
+            else
+            {
+                hi = this->readBits( count - 32 );
+                lo = this->readBits( 32 );
+            }
+            
+            return ( hi << 32 ) | lo;
+        }
+    }
+}
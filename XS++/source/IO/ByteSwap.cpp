@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ByteSwap.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <XS/IO/ByteSwap.hpp>
+
+#if defined( __SSSE3__ ) || defined( __AVX2__ )
+#include <immintrin.h>
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace ByteSwap
+        {
+            void SwapBytes16( uint8_t * data, size_t count )
+            {
+                size_t i( 0 );
+                
+                #if defined( __AVX2__ )
+                {
+                    const __m256i mask( _mm256_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 ) );
+                    
+                    for( ; i + 16 <= count; i += 16 )
+                    {
+                        __m256i v( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( data + ( i * 2 ) ) ) );
+                        
+                        _mm256_storeu_si256( reinterpret_cast< __m256i * >( data + ( i * 2 ) ), _mm256_shuffle_epi8( v, mask ) );
+                    }
+                }
+                #endif
+                
+                #if defined( __SSSE3__ )
+                {
+                    const __m128i mask( _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 ) );
+                    
+                    for( ; i + 8 <= count; i += 8 )
+                    {
+                        __m128i v( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ( i * 2 ) ) ) );
+                        
+                        _mm_storeu_si128( reinterpret_cast< __m128i * >( data + ( i * 2 ) ), _mm_shuffle_epi8( v, mask ) );
+                    }
+                }
+                #elif defined( __ARM_NEON )
+                for( ; i + 8 <= count; i += 8 )
+                {
+                    uint8_t * p( data + ( i * 2 ) );
+                    
+                    vst1q_u8( p, vrev16q_u8( vld1q_u8( p ) ) );
+                }
+                #endif
+                
+                for( ; i < count; i++ )
+                {
+                    uint16_t n;
+                    
+                    memcpy( &n, data + ( i * 2 ), sizeof( n ) );
+                    
+                    n = __builtin_bswap16( n );
+                    
+                    memcpy( data + ( i * 2 ), &n, sizeof( n ) );
+                }
+            }
+            
+            void Swap16( uint16_t * values, size_t count )
+            {
+                SwapBytes16( reinterpret_cast< uint8_t * >( values ), count );
+            }
+            
+            void SwapBytes32( uint8_t * data, size_t count )
+            {
+                size_t i( 0 );
+                
+                #if defined( __AVX2__ )
+                {
+                    const __m256i mask( _mm256_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 ) );
+                    
+                    for( ; i + 8 <= count; i += 8 )
+                    {
+                        __m256i v( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( data + ( i * 4 ) ) ) );
+                        
+                        _mm256_storeu_si256( reinterpret_cast< __m256i * >( data + ( i * 4 ) ), _mm256_shuffle_epi8( v, mask ) );
+                    }
+                }
+                #endif
+                
+                #if defined( __SSSE3__ )
+                {
+                    const __m128i mask( _mm_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 ) );
+                    
+                    for( ; i + 4 <= count; i += 4 )
+                    {
+                        __m128i v( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ( i * 4 ) ) ) );
+                        
+                        _mm_storeu_si128( reinterpret_cast< __m128i * >( data + ( i * 4 ) ), _mm_shuffle_epi8( v, mask ) );
+                    }
+                }
+                #elif defined( __ARM_NEON )
+                for( ; i + 4 <= count; i += 4 )
+                {
+                    uint8_t * p( data + ( i * 4 ) );
+                    
+                    vst1q_u8( p, vrev32q_u8( vld1q_u8( p ) ) );
+                }
+                #endif
+                
+                for( ; i < count; i++ )
+                {
+                    uint32_t n;
+                    
+                    memcpy( &n, data + ( i * 4 ), sizeof( n ) );
+                    
+                    n = __builtin_bswap32( n );
+                    
+                    memcpy( data + ( i * 4 ), &n, sizeof( n ) );
+                }
+            }
+            
+            void Swap32( uint32_t * values, size_t count )
+            {
+                SwapBytes32( reinterpret_cast< uint8_t * >( values ), count );
+            }
+            
+            void SwapBytes64( uint8_t * data, size_t count )
+            {
+                size_t i( 0 );
+                
+                #if defined( __AVX2__ )
+                {
+                    const __m256i mask( _mm256_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 ) );
+                    
+                    for( ; i + 4 <= count; i += 4 )
+                    {
+                        __m256i v( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( data + ( i * 8 ) ) ) );
+                        
+                        _mm256_storeu_si256( reinterpret_cast< __m256i * >( data + ( i * 8 ) ), _mm256_shuffle_epi8( v, mask ) );
+                    }
+                }
+                #endif
+                
+                #if defined( __SSSE3__ )
+                {
+                    const __m128i mask( _mm_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 ) );
+                    
+                    for( ; i + 2 <= count; i += 2 )
+                    {
+                        __m128i v( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + ( i * 8 ) ) ) );
+                        
+                        _mm_storeu_si128( reinterpret_cast< __m128i * >( data + ( i * 8 ) ), _mm_shuffle_epi8( v, mask ) );
+                    }
+                }
+                #elif defined( __ARM_NEON )
+                for( ; i + 2 <= count; i += 2 )
+                {
+                    uint8_t * p( data + ( i * 8 ) );
+                    
+                    vst1q_u8( p, vrev64q_u8( vld1q_u8( p ) ) );
+                }
+                #endif
+                
+                for( ; i < count; i++ )
+                {
+                    uint64_t n;
+                    
+                    memcpy( &n, data + ( i * 8 ), sizeof( n ) );
+                    
+                    n = __builtin_bswap64( n );
+                    
+                    memcpy( data + ( i * 8 ), &n, sizeof( n ) );
+                }
+            }
+            
+            void Swap64( uint64_t * values, size_t count )
+            {
+                SwapBytes64( reinterpret_cast< uint8_t * >( values ), count );
+            }
+        }
+    }
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        FixedPoint.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <XS/IO/FixedPoint.hpp>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
+
+namespace XS
+{
+    namespace IO
+    {
+        void FixedPointToFloat( const int8_t * values, float * out, size_t count, float scale )
+        {
+            for( size_t i = 0; i < count; i++ )
+            {
+                out[ i ] = static_cast< float >( values[ i ] ) * scale;
+            }
+        }
+        
+        void FixedPointToFloat( const uint8_t * values, float * out, size_t count, float scale )
+        {
+            for( size_t i = 0; i < count; i++ )
+            {
+                out[ i ] = static_cast< float >( values[ i ] ) * scale;
+            }
+        }
+        
+        void FixedPointToFloat( const int16_t * values, float * out, size_t count, float scale )
+        {
+            size_t i( 0 );
+            
+            #if defined( __SSE2__ )
+            {
+                const __m128 s( _mm_set1_ps( scale ) );
+                
+                for( ; i + 8 <= count; i += 8 )
+                {
+                    __m128i v(  _mm_loadu_si128( reinterpret_cast< const __m128i * >( values + i ) ) );
+                    __m128i lo( _mm_srai_epi32( _mm_unpacklo_epi16( v, v ), 16 ) );
+                    __m128i hi( _mm_srai_epi32( _mm_unpackhi_epi16( v, v ), 16 ) );
+                    
+                    _mm_storeu_ps( out + i,     _mm_mul_ps( _mm_cvtepi32_ps( lo ), s ) );
+                    _mm_storeu_ps( out + i + 4, _mm_mul_ps( _mm_cvtepi32_ps( hi ), s ) );
+                }
+            }
+            #elif defined( __ARM_NEON )
+            for( ; i + 8 <= count; i += 8 )
+            {
+                int16x8_t v( vld1q_s16( values + i ) );
+                
+                vst1q_f32( out + i,     vmulq_n_f32( vcvtq_f32_s32( vmovl_s16( vget_low_s16(  v ) ) ), scale ) );
+                vst1q_f32( out + i + 4, vmulq_n_f32( vcvtq_f32_s32( vmovl_s16( vget_high_s16( v ) ) ), scale ) );
+            }
+            #endif
+            
+            for( ; i < count; i++ )
+            {
+                out[ i ] = static_cast< float >( values[ i ] ) * scale;
+            }
+        }
+        
+        void FixedPointToFloat( const uint16_t * values, float * out, size_t count, float scale )
+        {
+            size_t i( 0 );
+            
+            #if defined( __SSE2__ )
+            {
+                const __m128  s( _mm_set1_ps( scale ) );
+                const __m128i zero( _mm_setzero_si128() );
+                
+                for( ; i + 8 <= count; i += 8 )
+                {
+                    __m128i v(  _mm_loadu_si128( reinterpret_cast< const __m128i * >( values + i ) ) );
+                    __m128i lo( _mm_unpacklo_epi16( v, zero ) );
+                    __m128i hi( _mm_unpackhi_epi16( v, zero ) );
+                    
+                    _mm_storeu_ps( out + i,     _mm_mul_ps( _mm_cvtepi32_ps( lo ), s ) );
+                    _mm_storeu_ps( out + i + 4, _mm_mul_ps( _mm_cvtepi32_ps( hi ), s ) );
+                }
+            }
+            #elif defined( __ARM_NEON )
+            for( ; i + 8 <= count; i += 8 )
+            {
+                uint16x8_t v( vld1q_u16( values + i ) );
+                
+                vst1q_f32( out + i,     vmulq_n_f32( vcvtq_f32_u32( vmovl_u16( vget_low_u16(  v ) ) ), scale ) );
+                vst1q_f32( out + i + 4, vmulq_n_f32( vcvtq_f32_u32( vmovl_u16( vget_high_u16( v ) ) ), scale ) );
+            }
+            #endif
+            
+            for( ; i < count; i++ )
+            {
+                out[ i ] = static_cast< float >( values[ i ] ) * scale;
+            }
+        }
+        
+        void FixedPointToFloat( const int32_t * values, float * out, size_t count, float scale )
+        {
+            size_t i( 0 );
+            
+            #if defined( __SSE2__ )
+            {
+                const __m128 s( _mm_set1_ps( scale ) );
+                
+                for( ; i + 4 <= count; i += 4 )
+                {
+                    __m128i v( _mm_loadu_si128( reinterpret_cast< const __m128i * >( values + i ) ) );
+                    
+                    _mm_storeu_ps( out + i, _mm_mul_ps( _mm_cvtepi32_ps( v ), s ) );
+                }
+            }
+            #elif defined( __ARM_NEON )
+            for( ; i + 4 <= count; i += 4 )
+            {
+                vst1q_f32( out + i, vmulq_n_f32( vcvtq_f32_s32( vld1q_s32( values + i ) ), scale ) );
+            }
+            #endif
+            
+            for( ; i < count; i++ )
+            {
+                out[ i ] = static_cast< float >( values[ i ] ) * scale;
+            }
+        }
+        
+        void FixedPointToFloat( const uint32_t * values, float * out, size_t count, float scale )
+        {
+            size_t i( 0 );
+            
+            #if defined( __SSE2__ )
+            {
+                const __m128  s( _mm_set1_ps( scale ) );
+                const __m128  high( _mm_set1_ps( 65536.0f ) );
+                const __m128i mask( _mm_set1_epi32( 0xFFFF ) );
+                
+                for( ; i + 4 <= count; i += 4 )
+                {
+                    __m128i v( _mm_loadu_si128( reinterpret_cast< const __m128i * >( values + i ) ) );
+                    __m128  h( _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( v, 16 ) ), high ) );
+                    __m128  l( _mm_cvtepi32_ps( _mm_and_si128( v, mask ) ) );
+                    
+                    _mm_storeu_ps( out + i, _mm_mul_ps( _mm_add_ps( h, l ), s ) );
+                }
+            }
+            #elif defined( __ARM_NEON )
+            for( ; i + 4 <= count; i += 4 )
+            {
+                vst1q_f32( out + i, vmulq_n_f32( vcvtq_f32_u32( vld1q_u32( values + i ) ), scale ) );
+            }
+            #endif
+            
+            for( ; i < count; i++ )
+            {
+                out[ i ] = static_cast< float >( values[ i ] ) * scale;
+            }
+        }
+    }
+}
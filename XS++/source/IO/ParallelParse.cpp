@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ParallelParse.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <atomic>
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <XS/IO/ParallelParse.hpp>
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace ParallelParse
+        {
+            std::vector< Range > FixedSizeRanges( size_t size, size_t recordSize, size_t recordsPerRange )
+            {
+                std::vector< Range > ranges;
+                size_t               length;
+                
+                if( recordSize == 0 || recordsPerRange == 0 )
+                {
+                    throw std::runtime_error( "Invalid range - Record size and count must not be zero" );
+                }
+                
+                if( size % recordSize != 0 )
+                {
+                    throw std::runtime_error( "Invalid range - Size is not a multiple of the record size" );
+                }
+                
+                length = recordSize * recordsPerRange;
+                
+                ranges.reserve( ( size + length - 1 ) / length );
+                
+                for( size_t offset = 0; offset < size; offset += length )
+                {
+                    ranges.emplace_back( offset, std::min( length, size - offset ) );
+                }
+                
+                return ranges;
+            }
+            
+            std::vector< Range > IndexRanges( const std::vector< size_t > & offsets, size_t size )
+            {
+                std::vector< Range > ranges;
+                
+                ranges.reserve( offsets.size() );
+                
+                for( size_t i = 0; i < offsets.size(); i++ )
+                {
+                    size_t end( ( i + 1 < offsets.size() ) ? offsets[ i + 1 ] : size );
+                    
+                    if( offsets[ i ] > end || end > size )
+                    {
+                        throw std::runtime_error( "Invalid range - Offsets must be ascending and within the stream" );
+                    }
+                    
+                    ranges.emplace_back( offsets[ i ], end - offsets[ i ] );
+                }
+                
+                return ranges;
+            }
+            
+            std::vector< Range > BoundaryRanges( const BinaryStream & stream, size_t count, const Finder & finder )
+            {
+                std::vector< Range > ranges;
+                size_t               size( stream.size() );
+                size_t               start( 0 );
+                
+                if( count == 0 )
+                {
+                    throw std::runtime_error( "Invalid range - Count must not be zero" );
+                }
+                
+                ranges.reserve( count );
+                
+                for( size_t i = 1; i <= count && start < size; i++ )
+                {
+                    size_t end( size );
+                    
+                    if( i < count )
+                    {
+                        end = std::max( finder( stream, std::max( start, ( size / count ) * i ) ), start );
+                    }
+                    
+                    if( end > size )
+                    {
+                        throw std::runtime_error( "Invalid range - Boundary is outside the stream" );
+                    }
+                    
+                    if( end > start )
+                    {
+                        ranges.emplace_back( start, end - start );
+                    }
+                    
+                    start = end;
+                }
+                
+                return ranges;
+            }
+            
+            void ForEach( size_t count, size_t threads, const std::function< void( size_t index ) > & body )
+            {
+                std::vector< std::thread > workers;
+                std::atomic< size_t >      next( 0 );
+                std::atomic< bool >        failed( false );
+                std::exception_ptr         exception;
+                std::mutex                 mutex;
+                std::function< void() >    work;
+                
+                if( threads == 0 )
+                {
+                    threads = std::max( std::thread::hardware_concurrency(), 1U );
+                }
+                
+                threads = std::min( threads, count );
+                
+                if( threads <= 1 )
+                {
+                    for( size_t i = 0; i < count; i++ )
+                    {
+                        body( i );
+                    }
+                    
+                    return;
+                }
+                
+                work = [ & ]()
+                {
+                    size_t i;
+                    
+                    while( failed.load( std::memory_order_relaxed ) == false && ( i = next.fetch_add( 1, std::memory_order_relaxed ) ) < count )
+                    {
+                        try
+                        {
+                            body( i );
+                        }
+                        catch( ... )
+                        {
+                            std::lock_guard< std::mutex > lock( mutex );
+                            
+                            if( exception == nullptr )
+                            {
+                                exception = std::current_exception();
+                            }
+                            
+                            failed.store( true, std::memory_order_relaxed );
+                        }
+                    }
+                };
+                
+                workers.reserve( threads - 1 );
+                
+                try
+                {
+                    for( size_t i = 1; i < threads; i++ )
+                    {
+                        workers.emplace_back( work );
+                    }
+                }
+                catch( ... )
+                {
+                    failed.store( true, std::memory_order_relaxed );
+                    
+                    for( std::thread & worker: workers )
+                    {
+                        worker.join();
+                    }
+                    
+                    throw;
+                }
+                
+                work();
+                
+                for( std::thread & worker: workers )
+                {
+                    worker.join();
+                }
+                
+                if( exception != nullptr )
+                {
+                    std::rethrow_exception( exception );
+                }
+            }
+        }
+    }
+}
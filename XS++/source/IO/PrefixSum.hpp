@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      PrefixSum.hpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#ifndef XS_IO_PREFIX_SUM_HPP
+#define XS_IO_PREFIX_SUM_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace Internal
+        {
+            inline uint32_t PrefixSum( uint32_t * values, size_t count, uint32_t previous )
+            {
+                size_t i( 0 );
+                
+                #if defined( __SSE2__ )
+                {
+                    __m128i sum( _mm_set1_epi32( static_cast< int >( previous ) ) );
+                    
+                    for( ; i + 4 <= count; i += 4 )
+                    {
+                        __m128i v( _mm_loadu_si128( reinterpret_cast< const __m128i * >( values + i ) ) );
+                        
+                        v   = _mm_add_epi32( v, _mm_slli_si128( v, 4 ) );
+                        v   = _mm_add_epi32( v, _mm_slli_si128( v, 8 ) );
+                        v   = _mm_add_epi32( v, sum );
+                        sum = _mm_shuffle_epi32( v, 0xFF );
+                        
+                        _mm_storeu_si128( reinterpret_cast< __m128i * >( values + i ), v );
+                    }
+                    
+                    if( i > 0 )
+                    {
+                        previous = values[ i - 1 ];
+                    }
+                }
+                #endif
+                
+                for( ; i < count; i++ )
+                {
+                    previous   += values[ i ];
+                    values[ i ] = previous;
+                }
+                
+                return previous;
+            }
+        }
+    }
+}
+
+#endif /* XS_IO_PREFIX_SUM_HPP */
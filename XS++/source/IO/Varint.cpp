@@ -0,0 +1,492 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2019 Jean-David Gadina - www.xs-labs.com
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Varint.cpp
+ * @copyright   (c) 2020, Jean-David Gadina - www.xs-labs.com
+ */
+
+#include <XS/IO/Varint.hpp>
+#include "PrefixSum.hpp"
+#include <stdexcept>
+#include <cstring>
+#include <bit>
+
+#if defined( __SSSE3__ )
+#include <tmmintrin.h>
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
+
+namespace XS
+{
+    namespace IO
+    {
+        namespace Varint
+        {
+            namespace
+            {
+                struct StreamVByteTable
+                {
+                    uint8_t shuffle[ 256 ][ 16 ];
+                    uint8_t length[ 256 ];
+                };
+                
+                constexpr StreamVByteTable MakeStreamVByteTable()
+                {
+                    StreamVByteTable table {};
+                    
+                    for( unsigned int control( 0 ); control < 256; control++ )
+                    {
+                        unsigned int offset( 0 );
+                        
+                        for( unsigned int i( 0 ); i < 4; i++ )
+                        {
+                            unsigned int length( ( ( control >> ( i * 2 ) ) & 3 ) + 1 );
+                            
+                            for( unsigned int j( 0 ); j < 4; j++ )
+                            {
+                                table.shuffle[ control ][ ( i * 4 ) + j ] = ( j < length ) ? static_cast< uint8_t >( offset + j ) : 0x80;
+                            }
+                            
+                            offset += length;
+                        }
+                        
+                        table.length[ control ] = static_cast< uint8_t >( offset );
+                    }
+                    
+                    return table;
+                }
+                
+                constexpr StreamVByteTable streamVByteTable( MakeStreamVByteTable() );
+                
+                uint64_t Load64( const uint8_t * data )
+                {
+                    uint64_t value;
+                    
+                    memcpy( &value, data, sizeof( value ) );
+                    
+                    if constexpr( std::endian::native != std::endian::little )
+                    {
+                        value = __builtin_bswap64( value );
+                    }
+                    
+                    return value;
+                }
+                
+                uint64_t Compact( uint64_t word )
+                {
+                    word &= 0x7F7F7F7F7F7F7F7FULL;
+                    word  = ( word & 0x007F007F007F007FULL ) | ( ( word & 0x7F007F007F007F00ULL ) >> 1 );
+                    word  = ( word & 0x00003FFF00003FFFULL ) | ( ( word & 0x3FFF00003FFF0000ULL ) >> 2 );
+                    word  = ( word & 0x000000000FFFFFFFULL ) | ( ( word & 0x0FFFFFFF00000000ULL ) >> 4 );
+                    
+                    return word;
+                }
+                
+                template< typename _T_ >
+                size_t DecodeUnsigned( const uint8_t * data, size_t size, _T_ & value )
+                {
+                    constexpr size_t  maxLength( ( ( sizeof( _T_ ) * 8 ) + 6 ) / 7 );
+                    constexpr uint8_t lastMask( static_cast< uint8_t >( 0xFF << ( ( sizeof( _T_ ) * 8 ) - ( 7 * ( maxLength - 1 ) ) ) ) );
+                    
+                    if( size >= 8 )
+                    {
+                        uint64_t word( Load64( data ) );
+                        uint64_t stops( ~word & 0x8080808080808080ULL );
+                        
+                        if( stops != 0 )
+                        {
+                            size_t length( static_cast< size_t >( std::countr_zero( stops ) / 8 ) + 1 );
+                            
+                            if( length > maxLength || ( length == maxLength && ( data[ length - 1 ] & lastMask ) != 0 ) )
+                            {
+                                throw std::runtime_error( "Invalid varint - Value too large" );
+                            }
+                            
+                            if( length < 8 )
+                            {
+                                word &= ( uint64_t( 1 ) << ( length * 8 ) ) - 1;
+                            }
+                            
+                            value = static_cast< _T_ >( Compact( word ) );
+                            
+                            return length;
+                        }
+                    }
+                    
+                    {
+                        _T_ result( 0 );
+                        
+                        for( size_t i( 0 ); i < maxLength && i < size; i++ )
+                        {
+                            uint8_t b( data[ i ] );
+                            
+                            if( i == maxLength - 1 && ( b & lastMask ) != 0 )
+                            {
+                                throw std::runtime_error( "Invalid varint - Value too large" );
+                            }
+                            
+                            result |= static_cast< _T_ >( static_cast< _T_ >( b & 0x7F ) << ( 7 * i ) );
+                            
+                            if( ( b & 0x80 ) == 0 )
+                            {
+                                value = result;
+                                
+                                return i + 1;
+                            }
+                        }
+                    }
+                    
+                    return 0;
+                }
+                
+                template< typename _T_ >
+                void Widen( const uint8_t * data, _T_ * values )
+                {
+                    #if defined( __SSE2__ )
+                    {
+                        const __m128i zero( _mm_setzero_si128() );
+                        __m128i       v(    _mm_loadu_si128( reinterpret_cast< const __m128i * >( data ) ) );
+                        __m128i       w[ 4 ];
+                        
+                        w[ 0 ] = _mm_unpacklo_epi16( _mm_unpacklo_epi8( v, zero ), zero );
+                        w[ 1 ] = _mm_unpackhi_epi16( _mm_unpacklo_epi8( v, zero ), zero );
+                        w[ 2 ] = _mm_unpacklo_epi16( _mm_unpackhi_epi8( v, zero ), zero );
+                        w[ 3 ] = _mm_unpackhi_epi16( _mm_unpackhi_epi8( v, zero ), zero );
+                        
+                        for( size_t i( 0 ); i < 4; i++ )
+                        {
+                            if constexpr( sizeof( _T_ ) == 4 )
+                            {
+                                _mm_storeu_si128( reinterpret_cast< __m128i * >( values + ( i * 4 ) ), w[ i ] );
+                            }
+                            else
+                            {
+                                _mm_storeu_si128( reinterpret_cast< __m128i * >( values + ( i * 4 ) ),     _mm_unpacklo_epi32( w[ i ], zero ) );
+                                _mm_storeu_si128( reinterpret_cast< __m128i * >( values + ( i * 4 ) + 2 ), _mm_unpackhi_epi32( w[ i ], zero ) );
+                            }
+                        }
+                    }
+                    #else
+                    for( size_t i( 0 ); i < 16; i++ )
+                    {
+                        values[ i ] = data[ i ];
+                    }
+                    #endif
+                }
+                
+                template< typename _T_ >
+                size_t DecodeArray( const uint8_t * data, size_t size, _T_ * values, size_t count )
+                {
+                    size_t pos( 0 );
+                    size_t i( 0 );
+                    
+                    while( i < count )
+                    {
+                        #if defined( __SSE2__ ) || ( defined( __ARM_NEON ) && defined( __aarch64__ ) )
+                        if( count - i >= 16 && size - pos >= 16 )
+                        {
+                            #if defined( __SSE2__ )
+                            unsigned int mask( static_cast< unsigned int >( _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + pos ) ) ) ) );
+                            size_t       n( ( mask == 0 ) ? 16 : static_cast< size_t >( std::countr_zero( mask ) ) );
+                            #else
+                            size_t       n( ( vmaxvq_u8( vld1q_u8( data + pos ) ) < 0x80 ) ? 16 : 0 );
+                            #endif
+                            
+                            if( n == 16 )
+                            {
+                                Widen( data + pos, values + i );
+                                
+                                pos += 16;
+                                i   += 16;
+                                
+                                continue;
+                            }
+                            
+                            for( size_t j( 0 ); j < n; j++ )
+                            {
+                                values[ i + j ] = data[ pos + j ];
+                            }
+                            
+                            pos += n;
+                            i   += n;
+                        }
+                        #endif
+                        
+                        {
+                            size_t length( DecodeUnsigned( data + pos, size - pos, values[ i ] ) );
+                            
+                            if( length == 0 )
+                            {
+                                throw std::runtime_error( "Invalid varint - Not enough data available" );
+                            }
+                            
+                            pos += length;
+                            i   += 1;
+                        }
+                    }
+                    
+                    return pos;
+                }
+                
+                template< typename _T_, typename _U_ >
+                void ZigZag( const _U_ * in, _T_ * out, size_t count )
+                {
+                    for( size_t i( 0 ); i < count; i++ )
+                    {
+                        out[ i ] = static_cast< _T_ >( ( in[ i ] >> 1 ) ^ ( ~( in[ i ] & 1 ) + 1 ) );
+                    }
+                }
+                
+                void PrefixSum( uint64_t * values, size_t count, uint64_t previous )
+                {
+                    for( size_t i( 0 ); i < count; i++ )
+                    {
+                        previous   += values[ i ];
+                        values[ i ] = previous;
+                    }
+                }
+            }
+            
+            size_t Decode( const uint8_t * data, size_t size, uint32_t & value )
+            {
+                return DecodeUnsigned( data, size, value );
+            }
+            
+            size_t Decode( const uint8_t * data, size_t size, uint64_t & value )
+            {
+                return DecodeUnsigned( data, size, value );
+            }
+            
+            size_t DecodeSigned( const uint8_t * data, size_t size, int64_t & value )
+            {
+                uint64_t result( 0 );
+                
+                if( size >= 8 )
+                {
+                    uint64_t word( Load64( data ) );
+                    uint64_t stops( ~word & 0x8080808080808080ULL );
+                    
+                    if( stops != 0 )
+                    {
+                        size_t length( static_cast< size_t >( std::countr_zero( stops ) / 8 ) + 1 );
+                        size_t bits( 7 * length );
+                        
+                        if( length < 8 )
+                        {
+                            word &= ( uint64_t( 1 ) << ( length * 8 ) ) - 1;
+                        }
+                        
+                        result = Compact( word );
+                        
+                        if( ( result & ( uint64_t( 1 ) << ( bits - 1 ) ) ) != 0 )
+                        {
+                            result |= ~uint64_t( 0 ) << bits;
+                        }
+                        
+                        value = static_cast< int64_t >( result );
+                        
+                        return length;
+                    }
+                }
+                
+                for( size_t i( 0 ); i < 10 && i < size; i++ )
+                {
+                    uint8_t b( data[ i ] );
+                    
+                    result |= static_cast< uint64_t >( b & 0x7F ) << ( 7 * i );
+                    
+                    if( ( b & 0x80 ) != 0 )
+                    {
+                        continue;
+                    }
+                    
+                    if( i == 9 )
+                    {
+                        if( b != 0x00 && b != 0x7F )
+                        {
+                            throw std::runtime_error( "Invalid varint - Value too large" );
+                        }
+                    }
+                    else if( ( b & 0x40 ) != 0 )
+                    {
+                        result |= ~uint64_t( 0 ) << ( 7 * ( i + 1 ) );
+                    }
+                    
+                    value = static_cast< int64_t >( result );
+                    
+                    return i + 1;
+                }
+                
+                if( size >= 10 )
+                {
+                    throw std::runtime_error( "Invalid varint - Value too large" );
+                }
+                
+                return 0;
+            }
+            
+            size_t Decode( const uint8_t * data, size_t size, uint32_t * values, size_t count )
+            {
+                return DecodeArray( data, size, values, count );
+            }
+            
+            size_t Decode( const uint8_t * data, size_t size, uint64_t * values, size_t count )
+            {
+                return DecodeArray( data, size, values, count );
+            }
+            
+            size_t DecodeZigZag( const uint8_t * data, size_t size, int32_t * values, size_t count )
+            {
+                uint32_t * u( reinterpret_cast< uint32_t * >( values ) );
+                size_t     length( DecodeArray( data, size, u, count ) );
+                
+                ZigZag( u, values, count );
+                
+                return length;
+            }
+            
+            size_t DecodeZigZag( const uint8_t * data, size_t size, int64_t * values, size_t count )
+            {
+                uint64_t * u( reinterpret_cast< uint64_t * >( values ) );
+                size_t     length( DecodeArray( data, size, u, count ) );
+                
+                ZigZag( u, values, count );
+                
+                return length;
+            }
+            
+            size_t DecodeDelta( const uint8_t * data, size_t size, uint32_t * values, size_t count, uint32_t previous )
+            {
+                size_t length( DecodeArray( data, size, values, count ) );
+                
+                Internal::PrefixSum( values, count, previous );
+                
+                return length;
+            }
+            
+            size_t DecodeDelta( const uint8_t * data, size_t size, uint64_t * values, size_t count, uint64_t previous )
+            {
+                size_t length( DecodeArray( data, size, values, count ) );
+                
+                PrefixSum( values, count, previous );
+                
+                return length;
+            }
+            
+            size_t StreamVByteDecode( const uint8_t * data, size_t size, uint32_t * values, size_t count )
+            {
+                size_t          controlLength( ( count / 4 ) + ( ( count % 4 ) ? 1 : 0 ) );
+                size_t          dataLength( 0 );
+                const uint8_t * control( data );
+                const uint8_t * pos( data + controlLength );
+                const uint8_t * end( data + size );
+                size_t          i( 0 );
+                
+                if( controlLength > size )
+                {
+                    throw std::runtime_error( "Invalid varint - Not enough data available" );
+                }
+                
+                for( size_t j( 0 ); j < count / 4; j++ )
+                {
+                    dataLength += streamVByteTable.length[ control[ j ] ];
+                }
+                
+                for( size_t j( 0 ); j < count % 4; j++ )
+                {
+                    dataLength += ( ( control[ count / 4 ] >> ( j * 2 ) ) & 3 ) + 1;
+                }
+                
+                if( dataLength > size - controlLength )
+                {
+                    throw std::runtime_error( "Invalid varint - Not enough data available" );
+                }
+                
+                #if defined( __SSSE3__ )
+                for( ; i + 4 <= count && end - pos >= 16; i += 4 )
+                {
+                    uint8_t c( control[ i / 4 ] );
+                    __m128i v( _mm_loadu_si128( reinterpret_cast< const __m128i * >( pos ) ) );
+                    __m128i s( _mm_loadu_si128( reinterpret_cast< const __m128i * >( streamVByteTable.shuffle[ c ] ) ) );
+                    
+                    _mm_storeu_si128( reinterpret_cast< __m128i * >( values + i ), _mm_shuffle_epi8( v, s ) );
+                    
+                    pos += streamVByteTable.length[ c ];
+                }
+                #elif defined( __ARM_NEON ) && defined( __aarch64__ )
+                for( ; i + 4 <= count && end - pos >= 16; i += 4 )
+                {
+                    uint8_t    c( control[ i / 4 ] );
+                    uint8x16_t v( vqtbl1q_u8( vld1q_u8( pos ), vld1q_u8( streamVByteTable.shuffle[ c ] ) ) );
+                    
+                    vst1q_u32( values + i, vreinterpretq_u32_u8( v ) );
+                    
+                    pos += streamVByteTable.length[ c ];
+                }
+                #else
+                ( void )end;
+                #endif
+                
+                for( ; i < count; i++ )
+                {
+                    size_t   length( ( ( control[ i / 4 ] >> ( ( i % 4 ) * 2 ) ) & 3 ) + 1 );
+                    uint32_t value( 0 );
+                    
+                    for( size_t j( 0 ); j < length; j++ )
+                    {
+                        value |= static_cast< uint32_t >( pos[ j ] ) << ( j * 8 );
+                    }
+                    
+                    values[ i ] = value;
+                    pos        += length;
+                }
+                
+                return static_cast< size_t >( pos - data );
+            }
+            
+            size_t StreamVByteDecodeZigZag( const uint8_t * data, size_t size, int32_t * values, size_t count )
+            {
+                uint32_t * u( reinterpret_cast< uint32_t * >( values ) );
+                size_t     length( StreamVByteDecode( data, size, u, count ) );
+                
+                ZigZag( u, values, count );
+                
+                return length;
+            }
+            
+            size_t StreamVByteDecodeDelta( const uint8_t * data, size_t size, uint32_t * values, size_t count, uint32_t previous )
+            {
+                size_t length( StreamVByteDecode( data, size, values, count ) );
+                
+                Internal::PrefixSum( values, count, previous );
+                
+                return length;
+            }
+        }
+    }
+}